@@ -0,0 +1,317 @@
+/*
+ * bench_heap.c - Benchmarks the SJF ready heap against a binary heap of process pointers
+ * Author: Tristan Thomas
+ * Date: 17-10-2026
+ *
+ * Each round inserts every queued process and then extracts them all, as when a burst of processes is allocated
+ * and then scheduled. Service and arrival times are drawn from small ranges so that many comparisons fall through
+ * to comparing names. The baseline is the binary heap min_heap.c used to be, which stores only pointers, compares
+ * the fields of the processes (and their names) on every step and sifts recursively. The batch column fills the heap
+ * with one insert_batch() call, as allocate_memory() now does when many processes are allocated at once.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <unistd.h>
+#include <string.h>
+#include <time.h>
+
+#include "process_data.h"
+#include "min_heap.h"
+#include "linked_list.h"
+
+#define NUM_SIZES 3
+#define MAX_SERVICE_TIME 1000
+#define MAX_ARRIVAL_TIME 100
+#define SEED 30023
+
+/* Definition of the baseline binary heap of pointers */
+typedef struct baseline_heap {
+    void **data;
+    int num_items;
+} baseline_heap_t;
+
+process_t **synthetic_processes(int num_processes);
+void baseline_insert(baseline_heap_t *heap, void *data);
+void *baseline_extract(baseline_heap_t *heap);
+void baseline_up(baseline_heap_t *heap, int index);
+void baseline_down(baseline_heap_t *heap, int index);
+int baseline_compare(process_t *p1, process_t *p2);
+double run_baseline(process_t **processes, int num_processes, int rounds);
+double run_heap(process_t **processes, int num_processes, int rounds);
+double run_batch(process_t **processes, int num_processes, int rounds);
+double elapsed_ns(struct timespec *start, struct timespec *end);
+
+
+/**
+ * Main entry point of benchmark
+ *
+ * @param argc Number of command line arguments
+ * @param argv Array of command line arguments (-n queued processes to only benchmark one size, -r rounds)
+ * @return 0 upon successful exit
+ */
+int main(int argc, char *argv[]) {
+
+    int sizes[NUM_SIZES] = {10000, 100000, 1000000};
+    int num_sizes = NUM_SIZES, max_size, rounds = 3, opt;
+    process_t **processes;
+    double baseline_ns, heap_ns, batch_ns;
+
+    while ((opt = getopt(argc, argv, "n:r:")) != -1) {
+        switch (opt) {
+            case 'n':
+                sizes[0] = atoi(optarg);
+                assert(sizes[0] > 0);
+                num_sizes = 1;
+                break;
+            case 'r':
+                rounds = atoi(optarg);
+                assert(rounds > 0);
+                break;
+            case '?':
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    max_size = sizes[num_sizes - 1];
+    processes = synthetic_processes(max_size);
+
+    for (int i = 0; i < num_sizes; i++) {
+        baseline_ns = run_baseline(processes, sizes[i], rounds);
+        heap_ns = run_heap(processes, sizes[i], rounds);
+        batch_ns = run_batch(processes, sizes[i], rounds);
+        printf("queued=%d baseline_ns=%.1lf heap_ns=%.1lf speedup=%.2lf batch_ns=%.1lf batch_speedup=%.2lf\n",
+               sizes[i], baseline_ns, heap_ns, baseline_ns / heap_ns, batch_ns, baseline_ns / batch_ns);
+    }
+
+    for (int i = 0; i < max_size; i++) {
+        free_process(processes[i]);
+    }
+    free(processes);
+    free_node_pool();
+
+    return 0;
+}
+
+/**
+ * Creates processes with random service and arrival times from small ranges, in random order
+ *
+ * @param num_processes Number of processes
+ * @return Array of processes
+ */
+process_t **synthetic_processes(int num_processes) {
+
+    list_t *list = NULL;
+    process_t **processes = malloc(num_processes * sizeof(*processes));
+    FILE *trace = tmpfile();
+    assert(processes && trace);
+
+    srand(SEED);
+    for (int i = 0; i < num_processes; i++) {
+        fprintf(trace, "%d P%07d %d 1\n", rand() % MAX_ARRIVAL_TIME, rand() % num_processes,
+                1 + rand() % MAX_SERVICE_TIME);
+    }
+    rewind(trace);
+
+    list = load_processes(list, &trace);
+    fclose(trace);
+    for (int i = 0; i < num_processes; i++) {
+        processes[i] = (process_t *) get_data(dequeue_node(list));
+    }
+    free_intrusive_list(list, blank);
+
+    return processes;
+}
+
+/**
+ * Times filling and draining the baseline heap
+ *
+ * @param processes Array of processes
+ * @param num_processes Number of processes queued at once
+ * @param rounds Number of times to fill and drain the heap
+ * @return Mean nanoseconds per insert and extract pair
+ */
+double run_baseline(process_t **processes, int num_processes, int rounds) {
+
+    baseline_heap_t heap = {malloc(num_processes * sizeof(void *)), 0};
+    struct timespec start, end;
+    assert(heap.data);
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int r = 0; r < rounds; r++) {
+        for (int i = 0; i < num_processes; i++) {
+            baseline_insert(&heap, processes[i]);
+        }
+        for (int i = 0; i < num_processes; i++) {
+            baseline_extract(&heap);
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    free(heap.data);
+
+    return elapsed_ns(&start, &end) / ((double) num_processes * rounds);
+}
+
+/**
+ * Times filling and draining the SJF ready heap
+ *
+ * @param processes Array of processes
+ * @param num_processes Number of processes queued at once
+ * @param rounds Number of times to fill and drain the heap
+ * @return Mean nanoseconds per insert and extract pair
+ */
+double run_heap(process_t **processes, int num_processes, int rounds) {
+
+    min_heap_t *heap = create_heap();
+    struct timespec start, end;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int r = 0; r < rounds; r++) {
+        for (int i = 0; i < num_processes; i++) {
+            insert_data(heap, processes[i]);
+        }
+        for (int i = 0; i < num_processes; i++) {
+            extract_min(heap);
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    free_heap(heap);
+
+    return elapsed_ns(&start, &end) / ((double) num_processes * rounds);
+}
+
+/**
+ * Times filling the SJF ready heap with one batch and draining it
+ *
+ * @param processes Array of processes
+ * @param num_processes Number of processes queued at once
+ * @param rounds Number of times to fill and drain the heap
+ * @return Mean nanoseconds per insert and extract pair
+ */
+double run_batch(process_t **processes, int num_processes, int rounds) {
+
+    min_heap_t *heap = create_heap();
+    struct timespec start, end;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int r = 0; r < rounds; r++) {
+        insert_batch(heap, (void **) processes, num_processes);
+        for (int i = 0; i < num_processes; i++) {
+            extract_min(heap);
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    free_heap(heap);
+
+    return elapsed_ns(&start, &end) / ((double) num_processes * rounds);
+}
+
+/**
+ * Adds a process to the baseline heap
+ *
+ * @param heap Baseline heap (with room for the process)
+ * @param data Process to be added
+ */
+void baseline_insert(baseline_heap_t *heap, void *data) {
+
+    heap->data[heap->num_items++] = data;
+    baseline_up(heap, heap->num_items - 1);
+}
+
+/**
+ * Removes the shortest process from the baseline heap
+ *
+ * @param heap Baseline heap
+ * @return Shortest process
+ */
+void *baseline_extract(baseline_heap_t *heap) {
+
+    void *min = heap->data[0];
+
+    heap->data[0] = heap->data[--heap->num_items];
+    baseline_down(heap, 0);
+
+    return min;
+
+}
+
+/**
+ * Moves a process up the baseline heap, swapping it with its parent
+ *
+ * @param heap Baseline heap
+ * @param index Index of process
+ */
+void baseline_up(baseline_heap_t *heap, int index) {
+
+    int parent = (index - 1) / 2;
+    void *temp;
+
+    if (index > 0 && baseline_compare(heap->data[parent], heap->data[index]) > 0) {
+        temp = heap->data[index];
+        heap->data[index] = heap->data[parent];
+        heap->data[parent] = temp;
+        baseline_up(heap, parent);
+    }
+
+}
+
+/**
+ * Moves a process down the baseline heap, swapping it with its smaller child
+ *
+ * @param heap Baseline heap
+ * @param index Index of process
+ */
+void baseline_down(baseline_heap_t *heap, int index) {
+
+    int smallest = index, left = 2 * index + 1, right = 2 * index + 2;
+    void *temp;
+
+    if (left < heap->num_items && baseline_compare(heap->data[smallest], heap->data[left]) > 0) {
+        smallest = left;
+    }
+    if (right < heap->num_items && baseline_compare(heap->data[smallest], heap->data[right]) > 0) {
+        smallest = right;
+    }
+
+    if (smallest != index) {
+        temp = heap->data[index];
+        heap->data[index] = heap->data[smallest];
+        heap->data[smallest] = temp;
+        baseline_down(heap, smallest);
+    }
+
+}
+
+/**
+ * Compares two processes by service time, arrival time and then name, as compare_process did before SJF keys
+ *
+ * @param p1 Process 1
+ * @param p2 Process 2
+ * @return <0 if p1 comes first, >0 if p2 comes first and 0 if they are equal
+ */
+int baseline_compare(process_t *p1, process_t *p2) {
+
+    if (get_value(p1, SERVICE_TIME) != get_value(p2, SERVICE_TIME)) {
+        return get_value(p1, SERVICE_TIME) < get_value(p2, SERVICE_TIME) ? -1 : 1;
+    } else if (get_value(p1, ARRIVAL_TIME) != get_value(p2, ARRIVAL_TIME)) {
+        return get_value(p1, ARRIVAL_TIME) < get_value(p2, ARRIVAL_TIME) ? -1 : 1;
+    }
+    return strcmp(get_name(p1), get_name(p2));
+
+}
+
+/**
+ * Gets the time between two points in nanoseconds
+ *
+ * @param start Start time
+ * @param end End time
+ * @return Elapsed nanoseconds
+ */
+double elapsed_ns(struct timespec *start, struct timespec *end) {
+
+    return (end->tv_sec - start->tv_sec) * 1e9 + (end->tv_nsec - start->tv_nsec);
+}
@@ -0,0 +1,240 @@
+/*
+ * bench_memory.c - Benchmarks the allocation latency of memory strategies on a trace of processes
+ * Author: Tristan Thomas
+ * Date: 17-10-2026
+ *
+ * Processes are allocated in the order of the trace, and whenever one does not fit the oldest allocated processes
+ * are deallocated until it does, so memory stays full and fragmented. Only allocate_memory() calls are timed.
+ * Cache misses can be compared by running one strategy at a time under perf, for example
+ *     perf stat -e cache-misses ./bench_memory -m bitmap
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <time.h>
+#include <inttypes.h>
+
+#include "process_data.h"
+#include "memory_allocation.h"
+#include "linked_list.h"
+
+// number of processes in the synthetic trace when no trace file is given
+#define NUM_SYNTHETIC 1000000
+#define SEED 30023
+
+list_t *synthetic_processes(int num_processes, uint64_t capacity);
+process_t **list_to_array(list_t *list, int *num_processes);
+void run_benchmark(char *mem_strategy, uint64_t capacity, process_t **processes, int num_processes);
+void enqueue_batch(list_t *list, process_t **processes, int num_processes);
+double elapsed_ns(struct timespec *start, struct timespec *end);
+
+
+/**
+ * Main entry point of benchmark
+ *
+ * @param argc Number of command line arguments
+ * @param argv Array of command line arguments (-f trace, -n synthetic processes, -m strategy and -M capacity)
+ * @return 0 upon successful exit
+ */
+int main(int argc, char *argv[]) {
+
+    char *strategies[] = {"best-fit", "bitmap"};
+    int num_strategies = sizeof(strategies) / sizeof(*strategies);
+    int num_processes = NUM_SYNTHETIC, opt;
+    uint64_t capacity = MEM_CAPACITY;
+    FILE *file = NULL;
+    list_t *processes = NULL;
+    process_t **trace;
+    int trace_size;
+
+    while ((opt = getopt(argc, argv, "f:n:m:M:")) != -1) {
+        switch (opt) {
+            case 'f':
+                file = fopen(optarg, "r");
+                assert(file);
+                break;
+            case 'n':
+                num_processes = atoi(optarg);
+                assert(num_processes > 0);
+                break;
+            case 'm':
+                // only benchmarks the given strategy
+                strategies[0] = optarg;
+                num_strategies = 1;
+                break;
+            case 'M':
+                capacity = strtoull(optarg, NULL, 10);
+                assert(capacity > 0);
+                break;
+            case '?':
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    if (file) {
+        processes = load_processes(processes, &file);
+        fclose(file);
+    } else {
+        processes = synthetic_processes(num_processes, capacity);
+    }
+
+    // each process links into one queue at a time, so the trace is kept as an array while they move between queues
+    trace = list_to_array(processes, &trace_size);
+
+    for (int i = 0; i < num_strategies; i++) {
+        run_benchmark(strategies[i], capacity, trace, trace_size);
+    }
+
+    for (int i = 0; i < trace_size; i++) {
+        free_process(trace[i]);
+    }
+    free(trace);
+    free_node_pool();
+
+    return 0;
+}
+
+/**
+ * Creates a trace of processes with random memory requirements of up to a quarter of memory
+ *
+ * @param num_processes Number of processes
+ * @param capacity Memory capacity in Bytes
+ * @return List of processes
+ */
+list_t *synthetic_processes(int num_processes, uint64_t capacity) {
+
+    list_t *processes = NULL;
+    FILE *trace = tmpfile();
+    assert(trace);
+
+    srand(SEED);
+    for (int i = 0; i < num_processes; i++) {
+        fprintf(trace, "%d P%07d 1 %" PRIu64 "\n", i, i, 1 + (uint64_t) rand() % (capacity / 4 ? capacity / 4 : 1));
+    }
+    rewind(trace);
+
+    processes = load_processes(processes, &trace);
+    fclose(trace);
+
+    return processes;
+}
+
+/**
+ * Moves the processes of a list into an array, keeping their order, and frees the list
+ *
+ * @param list List of processes
+ * @param num_processes Set to the number of processes
+ * @return Array of processes
+ */
+process_t **list_to_array(list_t *list, int *num_processes) {
+
+    process_t **processes = malloc(get_list_size(list) * sizeof(*processes));
+    node_t *node;
+    assert(processes);
+
+    *num_processes = 0;
+    while ((node = dequeue_node(list))) {
+        processes[(*num_processes)++] = (process_t *) get_data(node);
+    }
+    free_intrusive_list(list, blank);
+
+    return processes;
+}
+
+/**
+ * Allocates every process in the trace with a memory strategy and prints the mean allocation latency
+ *
+ * @param mem_strategy Memory strategy to be benchmarked
+ * @param capacity Memory capacity in Bytes
+ * @param processes Trace of processes
+ * @param num_processes Number of processes in the trace
+ */
+void run_benchmark(char *mem_strategy, uint64_t capacity, process_t **processes, int num_processes) {
+
+    memory_t *memory = initialise_memory(mem_strategy, capacity);
+    list_t *input = create_empty_list(), *allocated = create_empty_list();
+    struct timespec start, end;
+    unsigned long num_calls = 0;
+    double total_ns = 0;
+    process_t *process;
+
+    // READY lines are discarded so that printing is not timed
+    fflush(stdout);
+    int saved_stdout = dup(STDOUT_FILENO);
+    int dev_null = open("/dev/null", O_WRONLY);
+    assert(saved_stdout >= 0 && dev_null >= 0);
+    dup2(dev_null, STDOUT_FILENO);
+
+    for (int i = 0; i < num_processes; i++) {
+        process = processes[i];
+        // processes bigger than memory would never be allocated
+        if (get_mem_requirement(process) > capacity) {
+            continue;
+        }
+        enqueue_node(input, get_queue_node(process));
+
+        while (1) {
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            allocate_memory(memory, input, allocated, 0, (insert_func) enqueue_batch);
+            clock_gettime(CLOCK_MONOTONIC, &end);
+            total_ns += elapsed_ns(&start, &end);
+            num_calls++;
+
+            if (is_empty_list(input)) {
+                break;
+            }
+            // oldest process terminates to make room
+            assert(!is_empty_list(allocated));
+            process = (process_t *) get_data(dequeue_node(allocated));
+            deallocate_memory(process, memory);
+        }
+    }
+
+    while (!is_empty_list(allocated)) {
+        deallocate_memory(get_data(dequeue_node(allocated)), memory);
+    }
+
+    fflush(stdout);
+    dup2(saved_stdout, STDOUT_FILENO);
+    close(saved_stdout);
+    close(dev_null);
+
+    printf("%s processes=%d allocate_calls=%lu ns_per_call=%.1lf\n", mem_strategy, num_processes,
+           num_calls, total_ns / num_calls);
+
+    free_intrusive_list(input, blank);
+    free_intrusive_list(allocated, blank);
+    free_memory(memory);
+
+}
+
+/**
+ * Adds the processes allocated in one call to the end of the list of allocated processes
+ *
+ * @param list List of allocated processes
+ * @param processes Processes allocated in the call
+ * @param num_processes Number of processes
+ */
+void enqueue_batch(list_t *list, process_t **processes, int num_processes) {
+
+    for (int i = 0; i < num_processes; i++) {
+        enqueue_node(list, get_queue_node(processes[i]));
+    }
+
+}
+
+/**
+ * Gets the time between two points in nanoseconds
+ *
+ * @param start Start time
+ * @param end End time
+ * @return Elapsed nanoseconds
+ */
+double elapsed_ns(struct timespec *start, struct timespec *end) {
+
+    return (end->tv_sec - start->tv_sec) * 1e9 + (end->tv_nsec - start->tv_nsec);
+}
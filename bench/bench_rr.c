@@ -0,0 +1,211 @@
+/*
+ * bench_rr.c - Benchmarks rotating the round robin ready queue with many resident processes
+ * Author: Tristan Thomas
+ * Date: 17-10-2026
+ *
+ * Each rotation puts the running process at the back of the ready queue and takes the process at the front, as
+ * end_quantum() does for RR when a quantum ends with processes waiting. The ring buffer that is now the RR ready
+ * queue is compared with a list of nodes taken from the node pool (as enqueue() and dequeue() use) and with a list
+ * linked through the nodes embedded in the processes.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <unistd.h>
+#include <time.h>
+
+#include "process_data.h"
+#include "linked_list.h"
+#include "ring_buffer.h"
+
+#define NUM_RESIDENT 100000
+#define NUM_ROTATIONS 10000000
+#define SEED 30023
+
+process_t **synthetic_processes(int num_processes);
+double run_pooled_list(process_t **processes, int num_processes, long rotations);
+double run_intrusive_list(process_t **processes, int num_processes, long rotations);
+double run_ring(process_t **processes, int num_processes, long rotations);
+double elapsed_ns(struct timespec *start, struct timespec *end);
+
+
+/**
+ * Main entry point of benchmark
+ *
+ * @param argc Number of command line arguments
+ * @param argv Array of command line arguments (-n resident processes, -r rotations)
+ * @return 0 upon successful exit
+ */
+int main(int argc, char *argv[]) {
+
+    int num_processes = NUM_RESIDENT, opt;
+    long rotations = NUM_ROTATIONS;
+    process_t **processes;
+    double pooled_ns, intrusive_ns, ring_ns;
+
+    while ((opt = getopt(argc, argv, "n:r:")) != -1) {
+        switch (opt) {
+            case 'n':
+                num_processes = atoi(optarg);
+                assert(num_processes > 0);
+                break;
+            case 'r':
+                rotations = atol(optarg);
+                assert(rotations > 0);
+                break;
+            case '?':
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    processes = synthetic_processes(num_processes);
+
+    pooled_ns = run_pooled_list(processes, num_processes, rotations);
+    intrusive_ns = run_intrusive_list(processes, num_processes, rotations);
+    ring_ns = run_ring(processes, num_processes, rotations);
+    printf("resident=%d rotations=%ld pooled_list_ns=%.2lf intrusive_list_ns=%.2lf ring_ns=%.2lf "
+           "speedup_pooled=%.2lf speedup_intrusive=%.2lf\n", num_processes, rotations, pooled_ns, intrusive_ns,
+           ring_ns, pooled_ns / ring_ns, intrusive_ns / ring_ns);
+
+    for (int i = 0; i < num_processes; i++) {
+        free_process(processes[i]);
+    }
+    free(processes);
+    free_node_pool();
+
+    return 0;
+}
+
+/**
+ * Creates processes with random service times and memory requirements
+ *
+ * @param num_processes Number of processes
+ * @return Array of processes
+ */
+process_t **synthetic_processes(int num_processes) {
+
+    list_t *list = NULL;
+    process_t **processes = malloc(num_processes * sizeof(*processes));
+    FILE *trace = tmpfile();
+    assert(processes && trace);
+
+    srand(SEED);
+    for (int i = 0; i < num_processes; i++) {
+        fprintf(trace, "0 P%07d %d %d\n", i, 1 + rand() % 1000, 1 + rand() % 100);
+    }
+    rewind(trace);
+
+    list = load_processes(list, &trace);
+    fclose(trace);
+    for (int i = 0; i < num_processes; i++) {
+        processes[i] = (process_t *) get_data(dequeue_node(list));
+    }
+    free_intrusive_list(list, blank);
+
+    return processes;
+}
+
+/**
+ * Times rotating a list whose nodes come from the node pool
+ *
+ * @param processes Array of processes
+ * @param num_processes Number of resident processes (one running and the rest waiting)
+ * @param rotations Number of rotations
+ * @return Mean nanoseconds per rotation
+ */
+double run_pooled_list(process_t **processes, int num_processes, long rotations) {
+
+    list_t *ready = create_empty_list();
+    process_t *running = processes[0];
+    struct timespec start, end;
+
+    for (int i = 1; i < num_processes; i++) {
+        enqueue(ready, processes[i]);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (long r = 0; r < rotations; r++) {
+        enqueue(ready, running);
+        running = (process_t *) dequeue(ready);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    free_list(ready, blank);
+
+    return elapsed_ns(&start, &end) / rotations;
+}
+
+/**
+ * Times rotating a list linked through the nodes embedded in the processes
+ *
+ * @param processes Array of processes
+ * @param num_processes Number of resident processes (one running and the rest waiting)
+ * @param rotations Number of rotations
+ * @return Mean nanoseconds per rotation
+ */
+double run_intrusive_list(process_t **processes, int num_processes, long rotations) {
+
+    list_t *ready = create_empty_list();
+    process_t *running = processes[0];
+    struct timespec start, end;
+
+    for (int i = 1; i < num_processes; i++) {
+        enqueue_node(ready, get_queue_node(processes[i]));
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (long r = 0; r < rotations; r++) {
+        enqueue_node(ready, get_queue_node(running));
+        running = (process_t *) get_data(dequeue_node(ready));
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    // processes stay allocated, only their nodes are unlinked
+    while (dequeue_node(ready));
+    free_intrusive_list(ready, blank);
+
+    return elapsed_ns(&start, &end) / rotations;
+}
+
+/**
+ * Times rotating the ring buffer RR ready queue
+ *
+ * @param processes Array of processes
+ * @param num_processes Number of resident processes (one running and the rest waiting)
+ * @param rotations Number of rotations
+ * @return Mean nanoseconds per rotation
+ */
+double run_ring(process_t **processes, int num_processes, long rotations) {
+
+    ring_buffer_t *ready = create_ring_buffer();
+    process_t *running = processes[0];
+    struct timespec start, end;
+
+    for (int i = 1; i < num_processes; i++) {
+        ring_push_back(ready, processes[i]);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (long r = 0; r < rotations; r++) {
+        ring_push_back(ready, running);
+        running = (process_t *) ring_pop_front(ready);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    free_ring_buffer(ready, blank);
+
+    return elapsed_ns(&start, &end) / rotations;
+}
+
+/**
+ * Gets the time between two points in nanoseconds
+ *
+ * @param start Start time
+ * @param end End time
+ * @return Elapsed nanoseconds
+ */
+double elapsed_ns(struct timespec *start, struct timespec *end) {
+
+    return (end->tv_sec - start->tv_sec) * 1e9 + (end->tv_nsec - start->tv_nsec);
+}
@@ -0,0 +1,171 @@
+/*
+ * event_queue.c - Contains the priority queue of simulation events (ordered by time, then type, then creation)
+ * Author: Tristan Thomas
+ * Date: 17-10-2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "event_queue.h"
+#include "rb_tree.h"
+#include "linked_list.h"
+#include "pool.h"
+
+/* Definitions of an event and the event queue */
+struct event {
+    uint64_t time;
+    event_type_t type;
+    process_t *process;
+    // creation order so that equal events are handled first come first served
+    unsigned long id;
+    rb_node_t *node;
+};
+
+struct event_queue {
+    rb_tree_t *events;
+    pool_t *event_pool;
+    unsigned long num_events_created;
+};
+
+static int compare_events(event_t *event1, event_t *event2);
+
+
+/**
+ * Creates an empty event queue
+ *
+ * @return Empty event queue
+ */
+event_queue_t *create_event_queue() {
+
+    event_queue_t *queue = malloc(sizeof(*queue));
+    assert(queue);
+
+    queue->events = create_tree((tree_compare_func) compare_events);
+    queue->event_pool = create_pool(sizeof(event_t));
+    queue->num_events_created = 0;
+
+    return queue;
+
+}
+
+/**
+ * Adds an event to the queue
+ *
+ * @param queue Event queue
+ * @param time Simulation time of the event
+ * @param type Type of event
+ * @param process Process the event is about
+ * @return Event (handle for cancelling it)
+ */
+event_t *schedule_event(event_queue_t *queue, uint64_t time, event_type_t type, process_t *process) {
+
+    event_t *event = pool_alloc(queue->event_pool);
+
+    event->time = time;
+    event->type = type;
+    event->process = process;
+    event->id = queue->num_events_created++;
+    event->node = tree_insert(queue->events, event);
+
+    return event;
+
+}
+
+/**
+ * Removes an event from the queue before it happens and frees it
+ *
+ * @param queue Event queue
+ * @param event Event to be cancelled (nothing is done if NULL)
+ */
+void cancel_event(event_queue_t *queue, event_t *event) {
+
+    if (!event) {
+        return;
+    }
+
+    tree_delete(queue->events, event->node);
+    pool_free(queue->event_pool, event);
+
+}
+
+/**
+ * Gets the earliest event without removing it
+ *
+ * @param queue Event queue
+ * @return Earliest event or NULL if the queue is empty
+ */
+event_t *peek_event(event_queue_t *queue) {
+
+    rb_node_t *earliest = tree_min(queue->events);
+
+    return earliest ? (event_t *) get_tree_data(earliest) : NULL;
+}
+
+/**
+ * Gets the simulation time of an event
+ *
+ * @param event Specified event
+ * @return Time of event
+ */
+uint64_t get_event_time(event_t *event) {
+
+    return event->time;
+}
+
+/**
+ * Gets the type of an event
+ *
+ * @param event Specified event
+ * @return Type of event
+ */
+event_type_t get_event_type(event_t *event) {
+
+    return event->type;
+}
+
+/**
+ * Gets the process an event is about
+ *
+ * @param event Specified event
+ * @return Process of event
+ */
+process_t *get_event_process(event_t *event) {
+
+    return event->process;
+}
+
+/**
+ * Frees the event queue and any events left in it
+ *
+ * @param queue Event queue to be freed
+ */
+void free_event_queue(event_queue_t *queue) {
+
+    // events are freed with their pool
+    free_tree(queue->events, blank);
+    free_pool(queue->event_pool);
+    free(queue);
+    queue = NULL;
+
+}
+
+/**
+ * Compares two events by time, then type, then the order they were created in
+ *
+ * @param event1 First event
+ * @param event2 Second event
+ * @return <0 if event1 happens first, >0 if event2 happens first and 0 if they are the same event
+ */
+static int compare_events(event_t *event1, event_t *event2) {
+
+    if (event1->time != event2->time) {
+        return (event1->time < event2->time) ? -1 : 1;
+    } else if (event1->type != event2->type) {
+        return (event1->type < event2->type) ? -1 : 1;
+    } else if (event1->id != event2->id) {
+        return (event1->id < event2->id) ? -1 : 1;
+    }
+    return 0;
+}
@@ -0,0 +1,92 @@
+/*
+ * event_queue.h - Contains the interface for the priority queue of simulation events
+ * Author: Tristan Thomas
+ * Date: 17-10-2026
+ */
+
+#ifndef EVENT_QUEUE_H
+#define EVENT_QUEUE_H
+
+#include <stdint.h>
+
+typedef struct event_queue event_queue_t;
+typedef struct event event_t;
+typedef enum event_type event_type_t;
+typedef struct process process_t;
+
+// events at the same time are handled in this order
+enum event_type {
+    COMPLETION, QUANTUM_EXPIRY, ARRIVAL, BOOST
+};
+
+#define NUM_EVENT_TYPES 4
+// returned when there are no events left
+#define NO_EVENT UINT64_MAX
+
+
+/**
+ * Creates an empty event queue
+ *
+ * @return Empty event queue
+ */
+event_queue_t *create_event_queue();
+
+/**
+ * Adds an event to the queue
+ *
+ * @param queue Event queue
+ * @param time Simulation time of the event
+ * @param type Type of event
+ * @param process Process the event is about
+ * @return Event (handle for cancelling it)
+ */
+event_t *schedule_event(event_queue_t *queue, uint64_t time, event_type_t type, process_t *process);
+
+/**
+ * Removes an event from the queue before it happens and frees it
+ *
+ * @param queue Event queue
+ * @param event Event to be cancelled (nothing is done if NULL)
+ */
+void cancel_event(event_queue_t *queue, event_t *event);
+
+/**
+ * Gets the earliest event without removing it
+ *
+ * @param queue Event queue
+ * @return Earliest event or NULL if the queue is empty
+ */
+event_t *peek_event(event_queue_t *queue);
+
+/**
+ * Gets the simulation time of an event
+ *
+ * @param event Specified event
+ * @return Time of event
+ */
+uint64_t get_event_time(event_t *event);
+
+/**
+ * Gets the type of an event
+ *
+ * @param event Specified event
+ * @return Type of event
+ */
+event_type_t get_event_type(event_t *event);
+
+/**
+ * Gets the process an event is about
+ *
+ * @param event Specified event
+ * @return Process of event
+ */
+process_t *get_event_process(event_t *event);
+
+/**
+ * Frees the event queue and any events left in it
+ *
+ * @param queue Event queue to be freed
+ */
+void free_event_queue(event_queue_t *queue);
+
+#endif
@@ -0,0 +1,215 @@
+/*
+ * level_queue.c - Contains the multi-level queue, with a bitmap of the levels that are not empty
+ * Author: Tristan Thomas
+ * Date: 17-10-2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <assert.h>
+
+#include "level_queue.h"
+
+/* Definition of a multi-level queue */
+struct level_queue {
+    int num_levels;
+    list_t **levels;
+    // bit i is set if level i is not empty
+    uint64_t non_empty;
+    int size;
+};
+
+static void *take_from_level(level_queue_t *queue, int level, node_t *node);
+
+
+/**
+ * Creates an empty multi-level queue
+ *
+ * @param num_levels Number of levels (level 0 has the highest priority)
+ * @return Empty multi-level queue
+ */
+level_queue_t *create_level_queue(int num_levels) {
+
+    assert(num_levels > 0 && num_levels <= MAX_LEVELS);
+
+    level_queue_t *queue = malloc(sizeof(*queue));
+    assert(queue);
+    queue->levels = malloc(num_levels * sizeof(*queue->levels));
+    assert(queue->levels);
+
+    for (int i = 0; i < num_levels; i++) {
+        queue->levels[i] = create_empty_list();
+    }
+    queue->num_levels = num_levels;
+    queue->non_empty = 0;
+    queue->size = 0;
+
+    return queue;
+
+}
+
+/**
+ * Adds data to the back of a level, linking the node embedded in it
+ *
+ * @param queue Multi-level queue
+ * @param level Level to be added to
+ * @param node Node embedded in the data to be added (not in any list)
+ */
+void level_enqueue(level_queue_t *queue, int level, node_t *node) {
+
+    assert(level >= 0 && level < queue->num_levels);
+
+    enqueue_node(queue->levels[level], node);
+    queue->non_empty |= (uint64_t) 1 << level;
+    queue->size++;
+
+}
+
+/**
+ * Removes the data at the front of the highest priority level that is not empty
+ *
+ * @param queue Multi-level queue
+ * @param level Level the data was taken from (not set if the queue is empty)
+ * @return Data or NULL if the queue is empty
+ */
+void *level_dequeue(level_queue_t *queue, int *level) {
+
+    int top = get_top_level(queue);
+
+    if (top == NO_LEVEL) {
+        return NULL;
+    }
+    *level = top;
+
+    return take_from_level(queue, top, get_head(queue->levels[top]));
+
+}
+
+/**
+ * Removes the data at the back of the highest priority level that is not empty
+ *
+ * @param queue Multi-level queue
+ * @param level Level the data was taken from (not set if the queue is empty)
+ * @return Data or NULL if the queue is empty
+ */
+void *level_dequeue_back(level_queue_t *queue, int *level) {
+
+    int top = get_top_level(queue);
+
+    if (top == NO_LEVEL) {
+        return NULL;
+    }
+    *level = top;
+
+    return take_from_level(queue, top, get_tail(queue->levels[top]));
+
+}
+
+/**
+ * Gets the highest priority level that is not empty
+ *
+ * @param queue Multi-level queue
+ * @return Level or NO_LEVEL if the queue is empty
+ */
+int get_top_level(level_queue_t *queue) {
+
+    if (!queue->non_empty) {
+        return NO_LEVEL;
+    }
+    // lowest set bit
+    return __builtin_ctzll(queue->non_empty);
+
+}
+
+/**
+ * Moves everything into level 0, keeping the order of priority
+ *
+ * @param queue Multi-level queue
+ */
+void merge_levels(level_queue_t *queue) {
+
+    for (int i = 1; i < queue->num_levels; i++) {
+        append_list(queue->levels[0], queue->levels[i]);
+    }
+
+    queue->non_empty = queue->size ? 1 : 0;
+
+}
+
+/**
+ * Moves every level up by one, with level 1 joining the back of level 0
+ * Only the lists are moved, so the cost does not depend on the number of elements
+ *
+ * @param queue Multi-level queue
+ */
+void age_levels(level_queue_t *queue) {
+
+    if (queue->num_levels == 1) {
+        return;
+    }
+
+    append_list(queue->levels[0], queue->levels[1]);
+
+    // emptied list becomes the bottom level
+    list_t *empty = queue->levels[1];
+    for (int i = 1; i < queue->num_levels - 1; i++) {
+        queue->levels[i] = queue->levels[i + 1];
+    }
+    queue->levels[queue->num_levels - 1] = empty;
+
+    queue->non_empty = (queue->non_empty >> 1) | (queue->non_empty & 1);
+
+}
+
+/**
+ * Gets the number of elements in all levels
+ *
+ * @param queue Multi-level queue
+ * @return Number of elements
+ */
+int get_level_queue_size(level_queue_t *queue) {
+
+    return queue->size;
+}
+
+/**
+ * Frees the multi-level queue
+ *
+ * @param queue Multi-level queue to be freed
+ * @param free_data Function that frees data still in the queue (with the nodes embedded in it)
+ */
+void free_level_queue(level_queue_t *queue, free_func free_data) {
+
+    for (int i = 0; i < queue->num_levels; i++) {
+        free_intrusive_list(queue->levels[i], free_data);
+    }
+
+    free(queue->levels);
+    free(queue);
+    queue = NULL;
+
+}
+
+/**
+ * Unlinks a node from a level, clearing the bit of the level if it is now empty
+ *
+ * @param queue Multi-level queue
+ * @param level Level of the node
+ * @param node Node to be removed
+ * @return Data of the node
+ */
+static void *take_from_level(level_queue_t *queue, int level, node_t *node) {
+
+    void *data = get_data(node);
+
+    delete_node(queue->levels[level], node);
+    queue->size--;
+
+    if (is_empty_list(queue->levels[level])) {
+        queue->non_empty &= ~((uint64_t) 1 << level);
+    }
+
+    return data;
+
+}
@@ -0,0 +1,93 @@
+/*
+ * level_queue.h - Contains the interface for the multi-level queue (one first in first out queue per priority level)
+ * Author: Tristan Thomas
+ * Date: 17-10-2026
+ */
+
+#ifndef LEVEL_QUEUE_H
+#define LEVEL_QUEUE_H
+
+#include "linked_list.h"
+
+// levels are tracked in one 64 bit word so the highest priority level can be found with a single instruction
+#define MAX_LEVELS 64
+// returned when every level is empty
+#define NO_LEVEL -1
+
+typedef struct level_queue level_queue_t;
+
+
+/**
+ * Creates an empty multi-level queue
+ *
+ * @param num_levels Number of levels (level 0 has the highest priority)
+ * @return Empty multi-level queue
+ */
+level_queue_t *create_level_queue(int num_levels);
+
+/**
+ * Adds data to the back of a level, linking the node embedded in it
+ *
+ * @param queue Multi-level queue
+ * @param level Level to be added to
+ * @param node Node embedded in the data to be added (not in any list)
+ */
+void level_enqueue(level_queue_t *queue, int level, node_t *node);
+
+/**
+ * Removes the data at the front of the highest priority level that is not empty
+ *
+ * @param queue Multi-level queue
+ * @param level Level the data was taken from (not set if the queue is empty)
+ * @return Data or NULL if the queue is empty
+ */
+void *level_dequeue(level_queue_t *queue, int *level);
+
+/**
+ * Removes the data at the back of the highest priority level that is not empty
+ *
+ * @param queue Multi-level queue
+ * @param level Level the data was taken from (not set if the queue is empty)
+ * @return Data or NULL if the queue is empty
+ */
+void *level_dequeue_back(level_queue_t *queue, int *level);
+
+/**
+ * Gets the highest priority level that is not empty
+ *
+ * @param queue Multi-level queue
+ * @return Level or NO_LEVEL if the queue is empty
+ */
+int get_top_level(level_queue_t *queue);
+
+/**
+ * Moves everything into level 0, keeping the order of priority
+ *
+ * @param queue Multi-level queue
+ */
+void merge_levels(level_queue_t *queue);
+
+/**
+ * Moves every level up by one, with level 1 joining the back of level 0
+ *
+ * @param queue Multi-level queue
+ */
+void age_levels(level_queue_t *queue);
+
+/**
+ * Gets the number of elements in all levels
+ *
+ * @param queue Multi-level queue
+ * @return Number of elements
+ */
+int get_level_queue_size(level_queue_t *queue);
+
+/**
+ * Frees the multi-level queue
+ *
+ * @param queue Multi-level queue to be freed
+ * @param free_data Function that frees data still in the queue (with the nodes embedded in it)
+ */
+void free_level_queue(level_queue_t *queue, free_func free_data);
+
+#endif
@@ -9,20 +9,18 @@
 #include <assert.h>
 
 #include "linked_list.h"
+#include "pool.h"
 
-/* Definitions of double linked list node and main list */
-struct node {
-    void *data;
-    node_t *next;
-    node_t *prev;
-};
-
+/* Definition of main list (nodes are defined in the header so they can be embedded) */
 struct list {
     node_t *head;
     node_t *tail;
     int num_items;
 };
 
+// pool that the nodes of all lists are recycled through (created with the first node)
+static pool_t *node_pool = NULL;
+
 
 /**
  * Creates empty linked list
@@ -55,50 +53,92 @@ int enqueue(list_t *list, void *data) {
         return 0;
     }
 
-    node_t *new = create_node(data, NULL, list->tail);
+    enqueue_node(list, create_node(data, NULL, NULL));
+
+    // success
+    return 1;
+}
+
+/**
+ * Removes the head of a linked list
+ *
+ * @param list Linked list to be dequeued
+ * @return Data element stored in head of linked list
+ */
+void *dequeue(list_t *list) {
+
+    node_t *head = dequeue_node(list);
+    if (!head) {
+        return NULL;
+    }
+    void *data = head->data;
+
+    pool_free(node_pool, head);
+    head = NULL;
+
+    return data;
+}
+
+/**
+ * Sets up a node embedded in a data element so that it can be linked into lists
+ *
+ * @param node Embedded node
+ * @param data Data element containing the node
+ */
+void init_node(node_t *node, void *data) {
+
+    node->data = data;
+    node->next = NULL;
+    node->prev = NULL;
+}
+
+/**
+ * Links an existing node (such as one embedded in its data) at the end of a linked list, without allocating
+ *
+ * @param list Linked list to be inserted into
+ * @param node Node that is not in any list
+ */
+void enqueue_node(list_t *list, node_t *node) {
+
+    node->next = NULL;
+    node->prev = list->tail;
 
     // Empty linked list
     if (!list->head) {
-        list->head = new;
-        list->tail = new;
-        list->num_items++;
-        return 1;
+        list->head = node;
+    } else {
+        // tail extended by 1
+        list->tail->next = node;
     }
 
-    // tail extended by 1
-    list->tail->next = new;
-
     // new tail updated
-    list->tail = new;
-
+    list->tail = node;
     list->num_items++;
 
-    // success
-    return 1;
 }
 
 /**
- * Removes the head of a linked list
+ * Unlinks the head of a linked list without freeing it
  *
  * @param list Linked list to be dequeued
- * @return Data element stored in head of linked list
+ * @return Head node or NULL if the list is empty
  */
-void *dequeue(list_t *list) {
-    if (!list->head) {
+node_t *dequeue_node(list_t *list) {
+
+    node_t *head = list->head;
+    if (!head) {
         return NULL;
     }
-    node_t *head = list->head;
+
     list->head = head->next;
-    if (!list->head) {
+    if (list->head) {
+        list->head->prev = NULL;
+    } else {
         list->tail = NULL;
     }
     list->num_items--;
-    void *data = head->data;
-
-    free(head);
-    head = NULL;
 
-    return data;
+    return head;
 }
 
 /**
@@ -111,8 +151,11 @@ void *dequeue(list_t *list) {
  */
 node_t *create_node(void *data, node_t *next, node_t *prev) {
 
-    node_t *new_node = malloc(sizeof(*new_node));
-    assert(new_node);
+    if (!node_pool) {
+        node_pool = create_pool(sizeof(node_t));
+    }
+
+    node_t *new_node = pool_alloc(node_pool);
     new_node->data = data;
     new_node->next = next;
     new_node->prev = prev;
@@ -121,70 +164,48 @@ node_t *create_node(void *data, node_t *next, node_t *prev) {
 }
 
 /**
- * Inserts node into linked list in sorted order
+ * Frees a linked list and its data
  *
- * @param list List to be inserted into
- * @param block_node Node to be inserted
- * @param compare Comparison function
- * @param get_sort_value Function that returns value that determines sort order
+ * @param list Linked list to be freed
+ * @param free_data Function for freeing data
  */
-void insert_node_sorted(list_t *list, node_t *block_node, compare_func compare, get_sort_value_func get_sort_value) {
+void free_list(list_t *list, free_func free_data) {
 
-    node_t *head = list->head;
-    node_t *curr = head;
-    node_t *prev = NULL;
-    void *value = get_sort_value(get_data(block_node));
+    node_t *curr, *prev;
+
+    curr = list->head;
 
-    // as soon as block size is smaller insert in that position
-    while (curr && (compare(get_sort_value(get_data(get_data(curr))), value) < 0)) {
+    while (curr) {
         prev = curr;
         curr = curr->next;
+        free_data(prev->data);
+        prev->data = NULL;
+        pool_free(node_pool, prev);
+        prev = NULL;
     }
 
-    // creates new node
-    node_t *hole_node = create_node(block_node, curr, prev);
-
-
-    if (is_empty_list(list)) {
-        list->head = hole_node;
-        list->tail = hole_node;
-    } else if (!prev) {
-        // Insert at beginning
-        list->head = hole_node;
-        curr->prev = hole_node;
-    } else if (!curr) {
-        // Insert at tail
-        list->tail = hole_node;
-        prev->next = hole_node;
-    } else {
-        // Insert between previous and current
-        prev->next = hole_node;
-        curr->prev = hole_node;
-    }
-
-    list->num_items++;
+    free(list);
+    list = NULL;
 
 }
 
 /**
- * Frees a linked list and its data
+ * Frees a linked list whose nodes are embedded in their data, freeing the data (which frees the nodes with it)
  *
  * @param list Linked list to be freed
  * @param free_data Function for freeing data
  */
-void free_list(list_t *list, free_func free_data) {
+void free_intrusive_list(list_t *list, free_func free_data) {
 
     node_t *curr, *prev;
 
     curr = list->head;
 
+    // next node is read before the data holding the current node is freed
     while (curr) {
         prev = curr;
         curr = curr->next;
         free_data(prev->data);
-        prev->data = NULL;
-        free(prev);
-        prev = NULL;
     }
 
     free(list);
@@ -238,39 +259,37 @@ void delete_node(list_t *list, node_t *node) {
 }
 
 /**
- * Deletes node in a linked list by its data
+ * Frees a single node
  *
- * @param list Linked list to be deleted from
- * @param data Data of node to be deleted
- * @param free_data Freeing function for data
+ * @param node Node to be freed
+ * @param free_data Function to free data
  */
-void delete_node_by_data(list_t *list, void *data, free_func free_data) {
-
-    node_t *curr = get_head(list);
+void free_node(node_t *node, free_func free_data) {
 
-    // finds node with data
-    while (get_data(curr) != data) {
-        curr = get_next(curr);
-    }
+    free_data(node->data);
+    pool_free(node_pool, node);
+    node = NULL;
+}
 
-    delete_node(list, curr);
-    free_node(get_data(curr), free_data);
-    free(curr);
-    curr = NULL;
+/**
+ * Gets the largest number of list nodes that were in use at once (across all lists)
+ *
+ * @return Peak number of nodes
+ */
+int get_peak_nodes() {
 
+    return node_pool ? get_pool_peak(node_pool) : 0;
 }
 
 /**
- * Frees a single node
- *
- * @param node Node to be freed
- * @param free_data Function to free data
+ * Frees the memory of all list nodes at once (lists should be freed first)
  */
-void free_node(node_t *node, free_func free_data) {
+void free_node_pool() {
 
-    free_data(node->data);
-    free(node);
-    node = NULL;
+    if (node_pool) {
+        free_pool(node_pool);
+        node_pool = NULL;
+    }
 }
 
 /**
@@ -284,22 +303,64 @@ void free_node(node_t *node, free_func free_data) {
  */
 node_t *insert_node(list_t* list, void *data, node_t *prev, node_t *next) {
 
-    node_t *new = create_node(data, next, prev);
+    return link_node(list, create_node(data, next, prev), prev, next);
+}
+
+/**
+ * Links an existing node (such as one embedded in its data) between two given nodes, without allocating
+ *
+ * @param list List to be inserted into
+ * @param node Node that is not in any list
+ * @param prev Previous node
+ * @param next Next node
+ * @return The linked node
+ */
+node_t *link_node(list_t *list, node_t *node, node_t *prev, node_t *next) {
+
+    node->prev = prev;
+    node->next = next;
 
     if (prev) {
-        prev->next = new;
+        prev->next = node;
     } else {
-        list->head = new;
+        list->head = node;
     }
     if (next) {
-        next->prev = new;
+        next->prev = node;
     } else {
-        list->tail = new;
+        list->tail = node;
     }
 
     list->num_items++;
 
-    return new;
+    return node;
+}
+
+/**
+ * Moves all nodes of one list onto the end of another without copying them
+ *
+ * @param list List to be added to
+ * @param other List whose nodes are moved (left empty)
+ */
+void append_list(list_t *list, list_t *other) {
+
+    if (!other->head) {
+        return;
+    }
+
+    if (list->tail) {
+        list->tail->next = other->head;
+        other->head->prev = list->tail;
+    } else {
+        list->head = other->head;
+    }
+    list->tail = other->tail;
+    list->num_items += other->num_items;
+
+    other->head = NULL;
+    other->tail = NULL;
+    other->num_items = 0;
+
 }
 
 /**
@@ -323,6 +384,17 @@ node_t *get_head(list_t *list) {
     return list->head;
 }
 
+/**
+ * Gets the tail node of a given linked list
+ *
+ * @param list Specified list
+ * @return Tail node
+ */
+node_t *get_tail(list_t *list) {
+
+    return list->tail;
+}
+
 /**
  * Gets the data of a given linked list
  *
@@ -10,8 +10,14 @@
 typedef struct node node_t;
 typedef struct list list_t;
 typedef void (*free_func)(void *);
-typedef int (*compare_func)(void *, void *);
-typedef void *(*get_sort_value_func)(void *);
+
+/* Definition of double linked list node, public so that a node can be embedded in the element it links (an intrusive
+ * list never allocates nodes, as each element brings its own) */
+struct node {
+    void *data;
+    node_t *next;
+    node_t *prev;
+};
 
 
 /**
@@ -38,6 +44,30 @@ int enqueue(list_t *list, void *data);
  */
 void *dequeue(list_t *list);
 
+/**
+ * Sets up a node embedded in a data element so that it can be linked into lists
+ *
+ * @param node Embedded node
+ * @param data Data element containing the node
+ */
+void init_node(node_t *node, void *data);
+
+/**
+ * Links an existing node (such as one embedded in its data) at the end of a linked list, without allocating
+ *
+ * @param list Linked list to be inserted into
+ * @param node Node that is not in any list
+ */
+void enqueue_node(list_t *list, node_t *node);
+
+/**
+ * Unlinks the head of a linked list without freeing it
+ *
+ * @param list Linked list to be dequeued
+ * @return Head node or NULL if the list is empty
+ */
+node_t *dequeue_node(list_t *list);
+
 /**
  * Frees a linked list and its data
  *
@@ -46,6 +76,14 @@ void *dequeue(list_t *list);
  */
 void free_list(list_t *list, free_func free_data);
 
+/**
+ * Frees a linked list whose nodes are embedded in their data, freeing the data (which frees the nodes with it)
+ *
+ * @param list Linked list to be freed
+ * @param free_data Function for freeing data
+ */
+void free_intrusive_list(list_t *list, free_func free_data);
+
 /**
  * Checks if list is empty
  *
@@ -62,6 +100,14 @@ int is_empty_list(list_t *list);
  */
 node_t *get_head(list_t *list);
 
+/**
+ * Gets the tail node of a given linked list
+ *
+ * @param list Specified list
+ * @return Tail node
+ */
+node_t *get_tail(list_t *list);
+
 /**
  * Gets the data of a given linked list
  *
@@ -104,16 +150,6 @@ int get_list_size(list_t *list);
  */
 node_t *create_node(void *data, node_t *next, node_t *prev);
 
-/**
- * Inserts node into linked list in sorted order
- *
- * @param list List to be inserted into
- * @param block_node Node to be inserted
- * @param compare Comparison function
- * @param get_sort_value Function that returns value that determines sort order
- */
-void insert_node_sorted(list_t *list, node_t *block_node, compare_func compare, get_sort_value_func get_sort_value);
-
 /**
  * Deletes node in a linked list
  *
@@ -134,13 +170,23 @@ void delete_node(list_t *list, node_t *node);
 node_t *insert_node(list_t* list, void *data, node_t *prev, node_t *next);
 
 /**
- * Deletes node in a linked list by its data
+ * Links an existing node (such as one embedded in its data) between two given nodes, without allocating
  *
- * @param list Linked list to be deleted from
- * @param data Data of node to be deleted
- * @param free_data Freeing function for data
+ * @param list List to be inserted into
+ * @param node Node that is not in any list
+ * @param prev Previous node
+ * @param next Next node
+ * @return The linked node
  */
-void delete_node_by_data(list_t *list, void *data, free_func free_data);
+node_t *link_node(list_t *list, node_t *node, node_t *prev, node_t *next);
+
+/**
+ * Moves all nodes of one list onto the end of another without copying them
+ *
+ * @param list List to be added to
+ * @param other List whose nodes are moved (left empty)
+ */
+void append_list(list_t *list, list_t *other);
 
 /**
  * Frees a single node
@@ -150,6 +196,18 @@ void delete_node_by_data(list_t *list, void *data, free_func free_data);
  */
 void free_node(node_t *node, free_func free_data);
 
+/**
+ * Gets the largest number of list nodes that were in use at once (across all lists)
+ *
+ * @return Peak number of nodes
+ */
+int get_peak_nodes();
+
+/**
+ * Frees the memory of all list nodes at once (lists should be freed first)
+ */
+void free_node_pool();
+
 /**
  * Function that does nothing (used for free_list when data doesnt want to be freed)
  *
@@ -12,26 +12,40 @@
 #include <math.h>
 #include <signal.h>
 #include <sys/wait.h>
+#include <inttypes.h>
 
 #include "process_data.h"
 #include "memory_allocation.h"
 #include "linked_list.h"
-#include "min_heap.h"
+#include "event_queue.h"
+#include "scheduler.h"
 
+// number of arguments including all required flags
 #define NUM_ARGS 9
 #define HASH_SIZE 64
+// compaction cost when compaction is not enabled with -C
+#define NO_COMPACTION -1
+// write calls each message to a real process used to take (one per byte)
+#define BYTES_PER_MESSAGE 4
+// multi-level feedback queue defaults, the quantum of each level is double that of the level above
+#define MLFQ_LEVELS 3
+#define MAX_MLFQ_LEVELS 32
+#define BOOST_INTERVAL 100
+// waiting priority scheduled processes move up a priority level every interval
+#define AGING_INTERVAL 100
 
 #define IMPLEMENTS_REAL_PROCESS
 
-typedef process_t *(*extract_func)(void *);
-typedef int (*is_empty_func)(void *);
-
-void process_args(int argc, char **argv, char **scheduler, char **mem_strategy, int *quantum, FILE **file);
-void cycle(int quantum, list_t *processes, char *scheduler, char *mem_strategy);
-void finish_process(process_t *process, list_t *finished, list_t *memory, list_t *holes, int proc_remaining, uint32_t sim_time,
-                    char *mem_strategy);
-process_t *run_next_process(void *ready, uint32_t sim_time, extract_func extract, is_empty_func is_empty);
-void print_statistics(list_t *finished, int makespan);
+void process_args(int argc, char **argv, const scheduler_t **scheduler, char **mem_strategy, int *quantum, uint64_t *mem_capacity,
+                  double *compaction_cost, int *num_cpus, int *num_levels, uint32_t *boost_interval,
+                  uint32_t *aging_interval, int *verbose, FILE **file);
+void cycle(int quantum, list_t *processes, char *mem_strategy, uint64_t mem_capacity, double compaction_cost,
+           machine_t *machine, int verbose);
+void finish_process(process_t *process, list_t *finished, memory_t *memory, int proc_remaining, uint32_t sim_time);
+void run_process(process_t *process, int level, cpu_t *cpu, machine_t *machine, memory_t *memory, uint32_t sim_time);
+void print_statistics(list_t *finished, int makespan, machine_t *machine);
+void print_deadline_statistics(list_t *finished);
+void print_extra_statistics(memory_t *memory, unsigned long cycles_fast_forwarded);
 double mean(list_t *list, enum value field);
 double max(list_t *list, enum value field);
 void start_real_process(process_t *process, uint32_t sim_time);
@@ -40,6 +54,12 @@ void read_and_verify(process_t *process, uint8_t test_byte);
 void suspend_process(process_t *process, uint32_t sim_time);
 void continue_process(process_t *process, uint32_t sim_time);
 list_t *update_input(list_t *input, list_t *processes, uint32_t sim_time);
+uint64_t next_event_time(event_queue_t *events, event_t **next_arrival, list_t *processes, machine_t *machine,
+                         uint32_t sim_time, int quantum);
+unsigned long fast_forward(machine_t *machine, uint32_t sim_time, uint64_t next_time, int quantum);
+
+// number of messages sent to real processes
+static unsigned long num_messages_sent = 0;
 
 
 /**
@@ -51,26 +71,36 @@ list_t *update_input(list_t *input, list_t *processes, uint32_t sim_time);
  */
 int main(int argc, char *argv[]) {
 
-    int quantum;
-    char *scheduler = NULL, *mem_strategy = NULL;
+    int quantum, num_cpus = 1, num_levels = MLFQ_LEVELS, verbose = 0;
+    uint32_t boost_interval = BOOST_INTERVAL, aging_interval = AGING_INTERVAL;
+    uint64_t mem_capacity = MEM_CAPACITY;
+    double compaction_cost = NO_COMPACTION;
+    const scheduler_t *scheduler = NULL;
+    char *mem_strategy = NULL;
     FILE *input_file = NULL;
     list_t *processes = NULL;
+    machine_t *machine = NULL;
 
     // process command line arguments
-    process_args(argc, argv, &scheduler, &mem_strategy, &quantum, &input_file);
+    process_args(argc, argv, &scheduler, &mem_strategy, &quantum, &mem_capacity, &compaction_cost, &num_cpus,
+                 &num_levels, &boost_interval, &aging_interval, &verbose, &input_file);
 
     // load processes into linked list
     processes = load_processes(processes, &input_file);
 
+    // creates simulated CPUs
+    machine = create_machine(scheduler, quantum, num_cpus, num_levels, boost_interval, aging_interval);
+
     // completes processes
-    cycle(quantum, processes, scheduler, mem_strategy);
+    cycle(quantum, processes, mem_strategy, mem_capacity, compaction_cost, machine, verbose);
 
     // frees allocated memory
-    free(scheduler);
-    scheduler = NULL;
+    free_machine(machine);
+    machine = NULL;
     free(mem_strategy);
     mem_strategy = NULL;
-    free_list(processes, (void (*)(void *)) free_process);
+    free_intrusive_list(processes, (void (*)(void *)) free_process);
+    free_node_pool();
 
     fclose(input_file);
     input_file = NULL;
@@ -83,27 +113,35 @@ int main(int argc, char *argv[]) {
  *
  * @param argc Number of arguments
  * @param argv Array of arguments
- * @param scheduler Scheduler type
+ * @param scheduler Scheduling algorithm (exits if unknown)
  * @param mem_strategy Memory strategy
  * @param quantum Amount of time per cycle
+ * @param mem_capacity Memory capacity in Bytes (optional)
+ * @param compaction_cost Cost of moving a Byte when compacting memory (optional, compaction is off if not given)
+ * @param num_cpus Number of simulated CPUs (optional)
+ * @param num_levels Number of levels of the multi-level feedback queue (optional)
+ * @param boost_interval Time between moving all processes to the top level of the multi-level feedback queue (optional)
+ * @param aging_interval Time between moving waiting processes up a priority level (optional)
+ * @param verbose Whether to print extra statistics (optional)
  * @param file File to be read from
  */
-void process_args(int argc, char **argv, char **scheduler, char **mem_strategy, int *quantum, FILE **file) {
+void process_args(int argc, char **argv, const scheduler_t **scheduler, char **mem_strategy, int *quantum, uint64_t *mem_capacity,
+                  double *compaction_cost, int *num_cpus, int *num_levels, uint32_t *boost_interval,
+                  uint32_t *aging_interval, int *verbose, FILE **file) {
 
     int opt;
     // check correct amount of arguments
-    assert(argc == NUM_ARGS);
+    assert(argc >= NUM_ARGS);
 
     // Reads command line flags and values
-    while ((opt = getopt(argc, argv, "f:s:m:q:")) != -1) {
+    while ((opt = getopt(argc, argv, "f:s:m:q:M:C:c:L:B:A:v")) != -1) {
         switch (opt) {
             case 'm':
                 *mem_strategy = strdup(optarg);
                 assert(*mem_strategy);
                 break;
             case 's':
-                *scheduler = strdup(optarg);
-                assert(*scheduler);
+                *scheduler = get_scheduler(optarg);
                 break;
             case 'f':
                 *file = fopen(optarg, "r");
@@ -112,6 +150,33 @@ void process_args(int argc, char **argv, char **scheduler, char **mem_strategy,
             case 'q':
                 *quantum = atoi(optarg);
                 break;
+            case 'M':
+                *mem_capacity = strtoull(optarg, NULL, 10);
+                assert(*mem_capacity > 0);
+                break;
+            case 'C':
+                *compaction_cost = atof(optarg);
+                assert(*compaction_cost >= 0);
+                break;
+            case 'c':
+                *num_cpus = atoi(optarg);
+                assert(*num_cpus > 0);
+                break;
+            case 'L':
+                *num_levels = atoi(optarg);
+                assert(*num_levels > 0 && *num_levels <= MAX_MLFQ_LEVELS);
+                break;
+            case 'B':
+                *boost_interval = strtoul(optarg, NULL, 10);
+                assert(*boost_interval > 0);
+                break;
+            case 'A':
+                *aging_interval = strtoul(optarg, NULL, 10);
+                assert(*aging_interval > 0);
+                break;
+            case 'v':
+                *verbose = 1;
+                break;
             case '?':
                 exit(EXIT_FAILURE);
 
@@ -119,180 +184,133 @@ void process_args(int argc, char **argv, char **scheduler, char **mem_strategy,
 
     }
 
+    // check all required flags were given
+    assert(*scheduler && *mem_strategy && *file);
+
 
 }
 
 /**
- * Simulates the scheduling and completion of processes using either shortest job first or round robin algorithms
+ * Simulates the scheduling and completion of processes using one of the scheduling algorithms in scheduler.c
+ * Each CPU has its own ready queue, and CPUs that run out of work steal processes waiting for other CPUs
+ * Cycles happen every quantum, but cycles in which nothing runs or arrives are skipped by jumping to the next event,
+ * and cycles in which the running processes just continue are fast-forwarded
+ * Compacting memory stalls every CPU for the time it takes to move the blocks, so nothing runs during it
  *
  * @param quantum Amount of time per cycle
  * @param processes List of processes to be ran
- * @param scheduler Scheduling algorithm to be used
  * @param mem_strategy Memory strategy to be used
+ * @param mem_capacity Memory capacity in Bytes
+ * @param compaction_cost Cost of moving a Byte when compacting memory (NO_COMPACTION if memory is never compacted)
+ * @param machine Simulated CPUs
+ * @param verbose Whether to print extra statistics
  */
-void cycle(int quantum, list_t *processes, char *scheduler, char *mem_strategy) {
+void cycle(int quantum, list_t *processes, char *mem_strategy, uint64_t mem_capacity, double compaction_cost,
+           machine_t *machine, int verbose) {
 
     uint32_t sim_time = 0;
-    int num_cycles, processes_remaining, no_process_running, num_processes = get_list_size(processes);
+    uint64_t next_time, stall;
+    unsigned long cycles_fast_forwarded = 0;
+    int processes_remaining, level, num_processes = get_list_size(processes);
     // process lists
     list_t *input_queue = create_empty_list(), *finished_queue = create_empty_list();
-    void *ready_queue;
-    // memory lists
-    list_t *memory = create_empty_list();
-    list_t *holes = create_empty_list();
-    initialise_memory(memory, holes);
-    process_t *current_process = NULL;
-
-
-    for (num_cycles = 0; ; num_cycles++) {
-
-        // shortest job first algorithm - uses min heap for ready queue
-        if (strcmp(scheduler, "SJF") == 0) {
-
-            // for first cycle
-            if (num_cycles == 0) {
-
-                update_input(input_queue, processes, sim_time);
-                ready_queue = create_heap();
-                ready_queue = allocate_memory(memory, holes, input_queue, ready_queue, mem_strategy, sim_time,
-                                              (insert_func) insert_data);
-                current_process = run_next_process(ready_queue, sim_time, (extract_func) extract_min,
-                                                   (is_empty_func) is_empty_heap);
-                no_process_running = 0;
-                sim_time += quantum;
-                continue;
-            }
-
-            // updates service time of current process and finishes process if finished
-            if (update_time(quantum, current_process)) {
-
-                processes_remaining = get_list_size(input_queue) + get_heap_size(ready_queue);
-                finish_process(current_process, finished_queue, memory, holes, processes_remaining, sim_time, mem_strategy);
-                current_process = NULL;
-                no_process_running = 1;
+    cpu_t *cpu;
+    process_t *next_process;
+    // next arrival, and quantum expiry and completion on each CPU (cycles without any of these are skipped)
+    event_queue_t *events = create_event_queue();
+    event_t *next_arrival = NULL;
+    // memory blocks and holes
+    memory_t *memory = initialise_memory(mem_strategy, mem_capacity);
+    if (compaction_cost != NO_COMPACTION) {
+        enable_compaction(memory, compaction_cost);
+    }
 
-                if (get_list_size(finished_queue) == num_processes) {
-                    // all processes completed
-                    break;
-                }
+    while (1) {
 
+        // updates service time of running processes and finishes those that are finished
+        for (int i = 0; i < machine->num_cpus; i++) {
+            cpu = &machine->cpus[i];
+            if (!cpu->current_process) {
+                continue;
             }
 
-            // updates input queue
-            update_input(input_queue, processes, sim_time);
-
-            // updates ready queue
-            ready_queue = allocate_memory(memory, holes, input_queue, ready_queue, mem_strategy, sim_time,
-                                          (insert_func) insert_data);
-
-            // SJF scheduling algorithm
-            if (no_process_running) {
-                // starts new process if there is one available
-                if (is_empty_heap(ready_queue)) {
-                    current_process = NULL;
-                } else {
-                    current_process = run_next_process(ready_queue, sim_time, (extract_func) extract_min,
-                                                       (is_empty_func) is_empty_heap);
-                    no_process_running = 0;
-                }
-            } else {
-                // continues real process each cycle
-                continue_process(current_process, sim_time);
+            if (run_cycle(machine, cpu, quantum)) {
+                // processes still running on other CPUs have not finished either
+                processes_remaining = get_list_size(input_queue) + count_waiting(machine) + count_running(machine) - 1;
+                finish_process(cpu->current_process, finished_queue, memory, processes_remaining, sim_time);
+                cpu->current_process = NULL;
             }
+        }
 
+        if (get_list_size(finished_queue) == num_processes) {
+            // all processes completed
+            break;
+        }
 
-            // round robin algorithm - uses linked list as ready queue
-        } else if (strcmp(scheduler, "RR") == 0) {
-
-            // for first cycle
-            if (num_cycles == 0) {
-
-                update_input(input_queue, processes, sim_time);
-                ready_queue = create_empty_list();
-                ready_queue = allocate_memory(memory, holes, input_queue, ready_queue, mem_strategy, sim_time,
-                                              (insert_func) enqueue);
-                current_process = run_next_process(ready_queue, sim_time, (extract_func) dequeue,
-                                                   (is_empty_func) is_empty_list);
-                no_process_running = 0;
-                sim_time += quantum;
-                continue;
-            }
-
-            // updates service time of current process and finishes process if finished
-            if (update_time(quantum, current_process)) {
+        // updates input queue
+        update_input(input_queue, processes, sim_time);
 
-                processes_remaining = get_list_size(input_queue) + get_list_size(ready_queue);
+        // updates ready queues, giving each process to the least loaded CPU
+        allocate_memory(memory, input_queue, machine, sim_time, (insert_func) add_ready);
 
-                finish_process(current_process, finished_queue, memory, holes, processes_remaining, sim_time, mem_strategy);
-                no_process_running = 1;
+        // every CPU stalls while memory is compacted, and processes arriving meanwhile are allocated once it is done
+        while ((stall = take_compaction_stall(memory, quantum)) > 0) {
+            sim_time += (uint32_t) stall;
+            update_input(input_queue, processes, sim_time);
+            allocate_memory(memory, input_queue, machine, sim_time, (insert_func) add_ready);
+        }
 
-                if (get_list_size(finished_queue) == num_processes) {
-                    // all processes completed
-                    break;
-                }
+        // multi-level feedback queue periodically moves every process to the top level and priority scheduling ages
+        // waiting processes so none starve
+        boost_if_due(machine, sim_time);
 
-            }
+        for (int i = 0; i < machine->num_cpus; i++) {
+            cpu = &machine->cpus[i];
 
-            // updates input queue
-            update_input(input_queue, processes, sim_time);
-            // updates ready queue
-            ready_queue = allocate_memory(memory, holes, input_queue, ready_queue, mem_strategy, sim_time,
-                                          (insert_func) enqueue);
-
-            // RR scheduling algorithm
-            if (no_process_running) {
-
-                if (is_empty_list(ready_queue)) {
-                    // no processes available
-                    current_process = NULL;
-
-                } else {
-                    // runs a new process
-                    current_process = run_next_process(ready_queue, sim_time, (extract_func) dequeue,
-                                                       (is_empty_func) is_empty_list);
-                    no_process_running = 0;
+            if (!cpu->current_process) {
+                // starts the next process of this CPU, or one waiting for another CPU if it has none
+                next_process = pick_next(machine, cpu, &level);
+                if (next_process) {
+                    run_process(next_process, level, cpu, machine, memory, sim_time);
                 }
 
+            } else if ((next_process = end_quantum(machine, cpu, &level))) {
+                // suspends process, which is back in the ready queue, and runs the next one
+                set_state(cpu->current_process, READY);
+                suspend_process(cpu->current_process, sim_time);
+                run_process(next_process, level, cpu, machine, memory, sim_time);
 
             } else {
-
-                if (is_empty_list(ready_queue)) {
-                    // continues same process
-                    continue_process(current_process, sim_time);
-
-                } else {
-                    // suspends process and runs next in queue
-                    enqueue(ready_queue, current_process);
-                    suspend_process(current_process, sim_time);
-                    current_process = run_next_process(ready_queue, sim_time, (extract_func) dequeue,
-                                                       (is_empty_func) is_empty_list);
-
-                }
-
+                // continues real process each cycle
+                continue_process(cpu->current_process, sim_time);
             }
-
-
         }
 
-        // update simulation time
-        sim_time += quantum;
+        // jumps to the next cycle that has an event in it
+        next_time = next_event_time(events, &next_arrival, processes, machine, sim_time, quantum);
+        if (next_time == NO_EVENT) {
+            // nothing is running or arriving, so the processes left can never be allocated
+            break;
+        }
+        // boosts in the skipped cycles would find nothing waiting, so they must not pile up for later
+        skip_boosts(machine, next_time);
+        cycles_fast_forwarded += fast_forward(machine, sim_time, next_time, quantum);
+        sim_time = (uint32_t) next_time;
 
     }
 
-    print_statistics(finished_queue, sim_time);
+    print_statistics(finished_queue, sim_time, machine);
+    print_memory_statistics(memory);
+    if (verbose) {
+        print_extra_statistics(memory, cycles_fast_forwarded);
+    }
 
 
     // frees process and memory queues
-    free_list(finished_queue, (void (*)(void *)) free_process);
-    free_list(input_queue, (void (*)(void *)) free_process);
-    free_list(memory, (void (*)(void *)) free);
-    free_list(holes, blank);
-
-    if (strcmp(scheduler, "RR") == 0) {
-        free_list(ready_queue, (void (*)(void *)) free_process);
-    } else if (strcmp(scheduler, "SJF") == 0) {
-        free_heap(ready_queue);
-    }
+    free_intrusive_list(finished_queue, (void (*)(void *)) free_process);
+    free_intrusive_list(input_queue, (void (*)(void *)) free_process);
+    free_memory(memory);
+    free_event_queue(events);
 
 }
 
@@ -312,7 +330,7 @@ list_t *update_input(list_t *input, list_t *processes, uint32_t sim_time) {
     // adds processes into input queue when they arrive
     while ((uint32_t) get_value(get_data(get_head(processes)), ARRIVAL_TIME) <= sim_time) {
 
-        enqueue(input, dequeue(processes));
+        enqueue_node(input, dequeue_node(processes));
 
         if (is_empty_list(processes)) {
             break;
@@ -371,19 +389,16 @@ void continue_process(process_t *process, uint32_t sim_time) {
  *
  * @param process Process to be terminated
  * @param finished List of finished processes
- * @param memory Memory management list
- * @param holes List of holes
+ * @param memory Memory management data structure
  * @param proc_remaining Number of processes remaining that have arrived
  * @param sim_time Current simulation time
- * @param mem_strategy Memory strategy
  */
-void finish_process(process_t *process, list_t *finished, list_t *memory, list_t *holes, int proc_remaining, uint32_t sim_time,
-                    char *mem_strategy) {
+void finish_process(process_t *process, list_t *finished, memory_t *memory, int proc_remaining, uint32_t sim_time) {
 
     char sha256[HASH_SIZE];
 
     set_state(process, FINISHED);
-    enqueue(finished, process);
+    enqueue_node(finished, get_queue_node(process));
     printf("%u,FINISHED,process_name=%s,proc_remaining=%d\n", sim_time, get_name(process), proc_remaining);
 
     // terminate process
@@ -400,39 +415,44 @@ void finish_process(process_t *process, list_t *finished, list_t *memory, list_t
 
     set_value(process, sim_time, FINISH_TIME);
     update_stats(process);
-    deallocate_memory(process, memory, holes, mem_strategy);
+    deallocate_memory(process, memory);
 
 }
 
 /**
- * Runs the next process that is in the ready queue
+ * Runs a process on a CPU
  *
- * @param ready Queue containing processes that have been allocated memory
+ * @param process Process to be ran
+ * @param level Level the process was taken from (MLFQ only)
+ * @param cpu CPU the process runs on
+ * @param machine Simulated CPUs
+ * @param memory Memory management data structure
  * @param sim_time Current simulation time
- * @param extract Function that takes next process from ready queue
- * @param is_empty Function that checks if ready queue is empty
- * @return Process that will be ran
  */
-process_t *run_next_process(void *ready, uint32_t sim_time, extract_func extract, is_empty_func is_empty) {
+void run_process(process_t *process, int level, cpu_t *cpu, machine_t *machine, memory_t *memory, uint32_t sim_time) {
 
-    if (is_empty(ready)) {
-        return NULL;
-    }
-    process_t *current_process = extract(ready);
+    // paged memory loads the pages of a process when it runs
+    load_memory(memory, process, sim_time);
 
     // creates new process if not already created otherwise continues it
-    if (get_value(current_process, PID) == 0) {
-        start_real_process(current_process, sim_time);
+    if (get_value(process, PID) == 0) {
+        start_real_process(process, sim_time);
     } else {
-        continue_process(current_process, sim_time);
+        continue_process(process, sim_time);
     }
 
 
-    set_state(current_process, RUNNING);
-    printf("%u,RUNNING,process_name=%s,remaining_time=%d\n", sim_time, get_name(current_process),
-           (uint32_t) get_value(current_process, SERVICE_TIME_LEFT));
-
-    return current_process;
+    set_state(process, RUNNING);
+    cpu->current_process = process;
+    cpu->level = level;
+    cpu->level_cycles = 0;
+    printf("%u,RUNNING,process_name=%s,remaining_time=%d", sim_time, get_name(process),
+           (uint32_t) get_value(process, SERVICE_TIME_LEFT));
+    // the CPU is only shown when there is more than one
+    if (machine->num_cpus > 1) {
+        printf(",cpu=%d", cpu->id);
+    }
+    printf("\n");
 
 }
 
@@ -528,24 +548,27 @@ uint8_t send_bytes(process_t *process, uint32_t num) {
     *(uint32_t *) time_bytes = (uint32_t) num;
 
     // big endian (MSB in lowest mem address)
-    for (int i = 3; i >= 0; i--) {
-        if (write(get_fd_out(process)[WRITE], &time_bytes[i], 1) != 1) {
-            perror("write");
-            exit(EXIT_FAILURE);
-        }
+    uint8_t message[4] = {time_bytes[3], time_bytes[2], time_bytes[1], time_bytes[0]};
+
+    // sent in one write rather than one per byte, the process reads until it has all 4
+    if (write(get_fd_out(process)[WRITE], message, sizeof(message)) != sizeof(message)) {
+        perror("write");
+        exit(EXIT_FAILURE);
     }
+    num_messages_sent++;
 
     return time_bytes[0];
 
 }
 
 /**
- * Prints the statistics of the completed processes
+ * Prints the statistics of the completed processes, followed by those of the CPUs and scheduler
  *
  * @param finished List of completed processes
  * @param makespan Final simulation time
+ * @param machine Simulated CPUs
  */
-void print_statistics(list_t *finished, int makespan) {
+void print_statistics(list_t *finished, int makespan, machine_t *machine) {
 
     int avg_turnaround;
     double avg_overhead, max_overhead;
@@ -557,6 +580,61 @@ void print_statistics(list_t *finished, int makespan) {
     printf("Turnaround time %u\n", avg_turnaround);
     printf("Time overhead %.2lf %.2lf\n", max_overhead, avg_overhead);
     printf("Makespan %u\n", makespan);
+    print_deadline_statistics(finished);
+
+    print_scheduler_statistics(machine, makespan, finished);
+
+}
+
+/**
+ * Prints the number and share of processes with deadlines that finished after them, and the maximum lateness (finish
+ * time minus deadline, negative if every deadline was met early)
+ * Nothing is printed if no process has a deadline
+ *
+ * @param finished List of completed processes
+ */
+void print_deadline_statistics(list_t *finished) {
+
+    int num_deadlines = 0, num_misses = 0;
+    int64_t lateness, max_lateness = INT64_MIN;
+    process_t *process;
+
+    for (node_t *curr = get_head(finished); curr; curr = get_next(curr)) {
+        process = (process_t *) get_data(curr);
+        if (get_deadline(process) == NO_DEADLINE) {
+            continue;
+        }
+
+        lateness = (int64_t) get_value(process, FINISH_TIME) - (int64_t) get_deadline(process);
+        num_deadlines++;
+        num_misses += lateness > 0;
+        if (lateness > max_lateness) {
+            max_lateness = lateness;
+        }
+    }
+
+    if (!num_deadlines) {
+        return;
+    }
+    printf("Deadline misses %d %.2lf\n", num_misses, round((double) num_misses / num_deadlines * 100) / 100);
+    printf("Max lateness %" PRId64 "\n", max_lateness);
+
+}
+
+/**
+ * Prints statistics about the simulator itself rather than the processes
+ *
+ * @param memory Memory management data structure
+ * @param cycles_fast_forwarded Number of cycles in which the running process was only continued
+ */
+void print_extra_statistics(memory_t *memory, unsigned long cycles_fast_forwarded) {
+
+    // peak number of nodes and blocks that were live at once in their pools
+    printf("Peak list nodes %d\n", get_peak_nodes());
+    printf("Peak memory blocks %d\n", get_peak_blocks(memory));
+    printf("Cycles fast-forwarded %lu\n", cycles_fast_forwarded);
+    // each message is now one write instead of one per byte
+    printf("Syscalls saved %lu\n", num_messages_sent * (BYTES_PER_MESSAGE - 1));
 
 }
 
@@ -613,3 +691,100 @@ double max(list_t *list, enum value field) {
     return max;
 
 }
+
+/**
+ * Replaces the pending events with those of the current state and finds the next cycle with an event in it
+ * Cycles only start at multiples of the quantum, so events between cycles are handled in the cycle after them
+ *
+ * @param events Event queue
+ * @param next_arrival Pending arrival (NULL if there is none)
+ * @param processes List of processes that have not arrived yet
+ * @param machine Simulated CPUs, with the processes running in the next cycle
+ * @param sim_time Current simulation time
+ * @param quantum Amount of time per cycle
+ * @return Simulation time of the next cycle with an event or NO_EVENT if there are no events left
+ */
+uint64_t next_event_time(event_queue_t *events, event_t **next_arrival, list_t *processes, machine_t *machine,
+                         uint32_t sim_time, int quantum) {
+
+    process_t *arriving;
+    cpu_t *cpu;
+    uint64_t time_left, time;
+
+    cancel_event(events, *next_arrival);
+    *next_arrival = NULL;
+    if (!is_empty_list(processes)) {
+        arriving = (process_t *) get_data(get_head(processes));
+        *next_arrival = schedule_event(events, (uint64_t) get_value(arriving, ARRIVAL_TIME), ARRIVAL, arriving);
+    }
+
+    for (int i = 0; i < machine->num_cpus; i++) {
+        cpu = &machine->cpus[i];
+        cancel_event(events, cpu->completion);
+        cancel_event(events, cpu->quantum_expiry);
+        cpu->completion = NULL;
+        cpu->quantum_expiry = NULL;
+
+        if (!cpu->current_process) {
+            continue;
+        }
+
+        // quantum expiry if the scheduler could switch processes or change the level of the running process then
+        time = next_expiry(machine, cpu, sim_time, quantum);
+        if (time != NO_EVENT) {
+            cpu->quantum_expiry = schedule_event(events, time, QUANTUM_EXPIRY, cpu->current_process);
+        }
+        // running process finishes at the end of the quantum its service time runs out in
+        time_left = (uint64_t) get_value(cpu->current_process, SERVICE_TIME_LEFT);
+        cpu->completion = schedule_event(events, sim_time + (time_left + quantum - 1) / quantum * quantum,
+                                         COMPLETION, cpu->current_process);
+    }
+
+    cancel_event(events, machine->boost);
+    machine->boost = NULL;
+    if ((time = next_boost_time(machine)) != NO_EVENT) {
+        machine->boost = schedule_event(events, time, BOOST, NULL);
+    }
+
+    if (!peek_event(events)) {
+        return NO_EVENT;
+    }
+
+    return (get_event_time(peek_event(events)) + quantum - 1) / quantum * quantum;
+
+}
+
+/**
+ * Runs the running processes through the cycles before the next event, in which they would only be continued
+ * Each cycle still sends every process its simulation time, as the process hashes every time it is sent
+ *
+ * @param machine Simulated CPUs
+ * @param sim_time Current simulation time
+ * @param next_time Simulation time of the next cycle with an event
+ * @param quantum Amount of time per cycle
+ * @return Number of cycles fast-forwarded
+ */
+unsigned long fast_forward(machine_t *machine, uint32_t sim_time, uint64_t next_time, int quantum) {
+
+    unsigned long num_cycles = 0;
+    cpu_t *cpu;
+
+    if (!count_running(machine)) {
+        return 0;
+    }
+
+    // processes cannot finish before the next event as their completions are events
+    for (uint64_t time = (uint64_t) sim_time + quantum; time < next_time; time += quantum) {
+        for (int i = 0; i < machine->num_cpus; i++) {
+            cpu = &machine->cpus[i];
+            if (cpu->current_process) {
+                run_cycle(machine, cpu, quantum);
+                continue_process(cpu->current_process, (uint32_t) time);
+            }
+        }
+        num_cycles++;
+    }
+
+    return num_cycles;
+
+}
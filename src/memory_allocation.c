@@ -8,116 +8,461 @@
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+#include <math.h>
+#include <inttypes.h>
 
 #include "memory_allocation.h"
 #include "linked_list.h"
+#include "rb_tree.h"
+#include "pool.h"
 #include "process_data.h"
 
-/* Definitions of memory block and block type enum */
+/* Definitions of memory, memory block and block type enum */
 enum block_type {
     PROCESS, HOLE
 };
 
 struct block {
     block_type_t type;
-    int start_address;
-    int size;
+    uint64_t start_address;
+    uint64_t size;
+    // order holes were created in (newest hole wins ties between equally sized holes)
+    unsigned long hole_id;
+    // entry in the hole index (NULL if block is not a free hole)
+    rb_node_t *hole_node;
+    // entry in the buddy free list of its order (NULL if block is not a free buddy block)
+    node_t *free_node;
+    // links the block into the memory list ordered by address (embedded, so adding a block to the list never allocates)
+    node_t node;
+};
+
+struct memory {
+    uint64_t capacity;
+    // memory blocks ordered by address (blocks are recycled through the block pool)
+    list_t *blocks;
+    pool_t *block_pool;
+    // hole index ordered by size (nodes of blocks)
+    rb_tree_t *holes;
+    unsigned long num_holes_created;
+    // buddy free lists indexed by order, where a block of order k has size 2^k (nodes of blocks)
+    list_t **free_lists;
+    int max_order;
+    // totals used to measure internal fragmentation
+    uint64_t bytes_requested, bytes_allocated;
+    // roving pointer where the next next-fit search starts
+    node_t *next_fit;
+    // size of the largest free hole or buddy block (so requirements that are too big are rejected in O(1))
+    uint64_t largest_free;
+    // total size of all holes in the hole index
+    uint64_t free_bytes;
+    // compaction is only done once enabled, moving a Byte takes compaction_cost time units, which the CPUs stall for
+    // (the stall not yet taken and the total time stalled)
+    int compaction;
+    double compaction_cost;
+    unsigned long num_compactions;
+    uint64_t bytes_moved;
+    uint64_t pending_stall, compaction_time;
+    // paged memory frames, page tables of all processes and resident page tables from least to most recently run
+    uint64_t num_frames, free_frames;
+    list_t *page_tables;
+    list_t *lru;
+    unsigned long page_faults, evicted_frames;
+    // allocation bitmap where set bits are free units of 2^unit_shift Bytes
+    uint64_t *bitmap;
+    uint64_t num_units, free_units;
+    int unit_shift;
+    // incremented whenever memory is freed, processes that did not fit are only retried once it changes
+    unsigned long epoch, checked_epoch;
+    // last input queue node checked at checked_epoch (none of the nodes up to it fit)
+    node_t *last_checked;
+    // processes allocated in the current call, handed to the ready queue together once the input has been checked
+    process_t **batch;
+    int batch_size, batch_capacity;
+    const mem_strategy_t *strategy;
+};
+
+/* Memory strategy interface (resolved once when memory is initialised) */
+struct mem_strategy {
+    char *name;
+    // adds the initial block covering all of memory to the free memory index
+    void (*init)(memory_t *, node_t *);
+    // allocates a block to a process, returns 1 if successful and 0 if not
+    int (*allocate)(memory_t *, process_t *);
+    // frees the memory of a process once it has terminated (NULL if there is nothing to free)
+    void (*deallocate)(memory_t *, process_t *);
+    // checks whether a free block of at least the given size exists without allocating it
+    int (*can_fit)(memory_t *, uint64_t);
+    // prints statistics specific to the strategy (NULL if there are none)
+    void (*print_stats)(memory_t *);
+    // slides allocated blocks down to merge all free memory into one block (NULL if blocks cannot be moved)
+    void (*compact)(memory_t *);
+    // loads a process into memory when it is about to run (NULL if processes are loaded when allocated)
+    void (*load)(memory_t *, process_t *, uint32_t);
+};
+
+/* Definition of the page table of a process in paged memory */
+struct page_table {
+    process_t *process;
+    uint64_t num_pages;
+    // number of pages currently held in frames
+    uint64_t num_resident;
+    unsigned long page_faults, evicted_frames;
+    // entry in the least recently run list (NULL if no pages are resident)
+    node_t *lru_node;
 };
 
 typedef node_t *(*get_dir_func)(node_t *);
 
-static int best_fit(list_t *holes, list_t *memory, process_t *process);
-static void split(process_t *process, node_t *node, list_t *holes, list_t *memory);
-static void process_ready(process_t *process, void *ready, uint32_t sim_time, char *mem_strategy, insert_func insert);
-static void update_memory(list_t *memory, list_t *holes, node_t *main_node, node_t *adj_node);
-static void check_direction(list_t *memory, list_t *holes, node_t *block_node, get_dir_func get_dir);
-static block_t *create_block(block_type_t type, int start, int size);
+// size of a frame (and page) in paged memory, and the number of pages a process needs resident to run
+#define FRAME_SIZE 4
+#define MIN_RESIDENT_PAGES 4
+
+// bitmap allocation units are the smallest power of two Bytes that keeps the bitmap within this many units
+#define MAX_BITMAP_UNITS ((uint64_t) 1 << 24)
+#define WORD_BITS 64
+#define FULL_WORD (~(uint64_t) 0)
+#define NO_FREE_RUN UINT64_MAX
+
+// block sizes of buddy orders (orders fit in 64 bit addresses)
+#define MAX_ORDERS 64
+#define ORDER_SIZE(order) ((uint64_t) 1 << (order))
+
+// initial capacity of the batch of processes allocated in one call
+#define INIT_BATCH_SIZE 16
+
+static int infinite_fit(memory_t *memory, process_t *process);
+static int infinite_can_fit(memory_t *memory, uint64_t size);
+static int best_fit(memory_t *memory, process_t *process);
+static int worst_fit(memory_t *memory, process_t *process);
+static int first_fit(memory_t *memory, process_t *process);
+static int next_fit(memory_t *memory, process_t *process);
+static int hole_can_fit(memory_t *memory, uint64_t size);
+static void compact_holes(memory_t *memory);
+static void free_hole(memory_t *memory, process_t *process);
+static void init_buddy(memory_t *memory, node_t *block_node);
+static int buddy_fit(memory_t *memory, process_t *process);
+static int buddy_can_fit(memory_t *memory, uint64_t size);
+static void buddy_free(memory_t *memory, process_t *process);
+static void print_buddy_statistics(memory_t *memory);
+static void init_frames(memory_t *memory, node_t *block_node);
+static int page_fit(memory_t *memory, process_t *process);
+static int page_can_fit(memory_t *memory, uint64_t size);
+static void free_pages(memory_t *memory, process_t *process);
+static void load_pages(memory_t *memory, process_t *process, uint32_t sim_time);
+static void evict_pages(memory_t *memory, page_table_t *page_table, uint32_t sim_time);
+static void remove_lru(memory_t *memory, page_table_t *page_table);
+static void print_paging_statistics(memory_t *memory);
+static void init_bitmap(memory_t *memory, node_t *block_node);
+static int bitmap_fit(memory_t *memory, process_t *process);
+static int bitmap_can_fit(memory_t *memory, uint64_t size);
+static void bitmap_free(memory_t *memory, process_t *process);
+static uint64_t find_free_run(memory_t *memory, uint64_t length);
+static void set_units(memory_t *memory, uint64_t start, uint64_t length, int is_free);
+static void insert_free_block(memory_t *memory, node_t *block_node, int order);
+static void remove_free_block(memory_t *memory, node_t *block_node, int order);
+static int get_order(uint64_t size);
+static void split(process_t *process, node_t *node, memory_t *memory);
+static uint64_t allocate_waiting(memory_t *memory, list_t *input, uint32_t sim_time);
+static void process_ready(memory_t *memory, process_t *process, uint32_t sim_time);
+static void update_memory(memory_t *memory, node_t *main_node, node_t *adj_node);
+static void check_direction(memory_t *memory, node_t *block_node, get_dir_func get_dir);
+static void insert_hole(memory_t *memory, node_t *block_node);
+static void remove_hole(memory_t *memory, node_t *block_node);
+static int compare_holes(node_t *hole1, node_t *hole2);
+static int compare_hole_size(node_t *hole, uint64_t *size);
+static block_t *create_block(memory_t *memory, block_type_t type, uint64_t start, uint64_t size);
+static void free_block_node(memory_t *memory, node_t *block_node);
+
+static const mem_strategy_t strategies[] = {
+        {"infinite", insert_hole, infinite_fit, NULL, infinite_can_fit, NULL, NULL, NULL},
+        {"best-fit", insert_hole, best_fit, free_hole, hole_can_fit, NULL, compact_holes, NULL},
+        {"worst-fit", insert_hole, worst_fit, free_hole, hole_can_fit, NULL, compact_holes, NULL},
+        {"first-fit", insert_hole, first_fit, free_hole, hole_can_fit, NULL, compact_holes, NULL},
+        {"next-fit", insert_hole, next_fit, free_hole, hole_can_fit, NULL, compact_holes, NULL},
+        {"buddy", init_buddy, buddy_fit, buddy_free, buddy_can_fit, print_buddy_statistics, NULL, NULL},
+        {"virtual", init_frames, page_fit, free_pages, page_can_fit, print_paging_statistics, NULL, load_pages},
+        {"bitmap", init_bitmap, bitmap_fit, bitmap_free, bitmap_can_fit, NULL, NULL, NULL},
+};
+
+#define NUM_STRATEGIES (sizeof(strategies) / sizeof(*strategies))
 
 
 /**
  * Allocates memory to a process depending on the memory strategy
+ * Processes must only be added to the end of the input queue between calls, as processes that did not fit in a previous
+ * call are skipped until memory is freed
+ * If compaction is enabled and a process only failed to fit because free memory was fragmented, memory is compacted
+ * and the waiting processes are checked again, and the time moving the blocks takes is left for the CPUs to stall for
+ * All processes allocated in the call are inserted into the ready queue at once, so heaps can be built bottom-up
  *
  * @param memory Memory management data structure
- * @param holes List of free memory blocks (nodes of memory)
  * @param input List of unallocated and arrived processes
  * @param ready List of allocated processes (data structure depending on scheduling algorithm)
- * @param mem_strategy Memory allocation strategy
  * @param sim_time Simulation time
- * @param insert Function to insert process into ready queue
+ * @param insert Function to insert all processes allocated in the call into the ready queue at once
  * @return Ready queue
  */
-void *allocate_memory(list_t *memory, list_t *holes, list_t *input, void *ready, char *mem_strategy, uint32_t sim_time,
-                      insert_func insert) {
-    process_t *process;
-    if (strcmp(mem_strategy, "infinite") == 0) {
+void *allocate_memory(memory_t *memory, list_t *input, void *ready, uint32_t sim_time, insert_func insert) {
+
+    uint64_t smallest_waiting = allocate_waiting(memory, input, sim_time);
+    uint64_t bytes_moved = memory->bytes_moved;
+
+    // enough memory is free for a waiting process but it is split between holes, so holes are merged and retried
+    if (memory->compaction && memory->strategy->compact && smallest_waiting <= memory->free_bytes &&
+        smallest_waiting > memory->largest_free) {
+        memory->strategy->compact(memory);
+        memory->pending_stall += (uint64_t) ceil((memory->bytes_moved - bytes_moved) * memory->compaction_cost);
+        memory->num_compactions++;
+        memory->epoch++;
+        allocate_waiting(memory, input, sim_time);
+    }
 
-        // transfer the process straight to ready
-        while ((process = dequeue(input)) != NULL) {
-            process_ready(process, ready, sim_time, mem_strategy, insert);
-        }
+    if (memory->batch_size > 0) {
+        insert(ready, memory->batch, memory->batch_size);
+        memory->batch_size = 0;
+    }
 
-    } else if (strcmp(mem_strategy, "best-fit") == 0) {
+    return ready;
+}
 
-        node_t *curr = get_head(input);
-        node_t *next;
-        int is_space;
+/**
+ * Allocates memory to each process in the input queue that fits, skipping processes already checked since memory
+ * was last freed
+ *
+ * @param memory Memory management data structure
+ * @param input List of unallocated and arrived processes
+ * @param sim_time Simulation time
+ * @return Smallest requirement of the checked processes that did not fit (UINT64_MAX if all fit)
+ */
+static uint64_t allocate_waiting(memory_t *memory, list_t *input, uint32_t sim_time) {
 
-        while (curr) {
-            process = (process_t *) get_data(curr);
+    const mem_strategy_t *strategy = memory->strategy;
+    process_t *process;
+    node_t *curr;
+    node_t *next;
+    uint64_t requirement;
+    uint64_t smallest_waiting = UINT64_MAX;
 
-            if ((is_space = best_fit(holes, memory, process))) {
-                process_ready(process, ready, sim_time, mem_strategy, insert);
-                delete_node(input, curr);
-            }
-            next = get_next(curr);
-            if (is_space) {
-                free(curr);
-                curr = NULL;
+    if (memory->epoch == memory->checked_epoch && memory->last_checked) {
+        // nothing freed so processes that did not fit still will not, only check newly arrived processes
+        curr = get_next(memory->last_checked);
+    } else {
+        curr = get_head(input);
+        memory->last_checked = NULL;
+    }
+
+    while (curr) {
+        process = (process_t *) get_data(curr);
+        requirement = get_mem_requirement(process);
+        next = get_next(curr);
+
+        if (strategy->can_fit(memory, requirement) && strategy->allocate(memory, process)) {
+            // the node is the process's own, so it is only unlinked before the process joins a ready queue
+            delete_node(input, curr);
+            process_ready(memory, process, sim_time);
+        } else {
+            memory->last_checked = curr;
+            if (requirement < smallest_waiting) {
+                smallest_waiting = requirement;
             }
-            curr = next;
         }
+        curr = next;
+    }
 
+    memory->checked_epoch = memory->epoch;
 
-    }
+    return smallest_waiting;
+}
 
-    return ready;
+/**
+ * Transfers the process straight to ready without giving it a block (memory is never full)
+ *
+ * @param memory Memory management data structure
+ * @param process Process to be allocated
+ * @return 1 as there is always space
+ */
+static int infinite_fit(memory_t *memory, process_t *process) {
+
+    return 1;
+}
+
+/**
+ * Checks if there could be room in infinite memory
+ *
+ * @param memory Memory management data structure
+ * @param size Required size
+ * @return 1 as there is always space
+ */
+static int infinite_can_fit(memory_t *memory, uint64_t size) {
+
+    return 1;
 }
 
 /**
  * Checks if there is room in memory and if so allocates this memory
  *
- * @param holes List of holes (nodes of memory)
- * @param memory Memory allocation list
+ * @param memory Memory management data structure
  * @param process Process to be allocated
  * @return 1 if there is space, 0 if not
  */
-static int best_fit(list_t *holes, list_t *memory, process_t *process) {
+static int best_fit(memory_t *memory, process_t *process) {
 
-    int is_space;
-    node_t *curr = get_head(holes);
-    node_t *best_fit = NULL;
+    uint64_t requirement = get_mem_requirement(process);
+    // smallest hole that is bigger than or equal to what is needed
+    rb_node_t *best_fit = tree_lower_bound(memory->holes, &requirement, (tree_compare_func) compare_hole_size);
     node_t *mem_node = NULL;
 
-    while ((is_space = (curr != NULL))) {
-        block_t *curr_block = (block_t *) get_data(get_data(curr));
-        // keep iterating until block is bigger than or equal to what is needed
-        if (curr_block->size >= (int) get_value(process, MEMORY_REQUIREMENT)) {
-            best_fit = curr;
-            break;
+    if (!best_fit) {
+        return 0;
+    }
+
+    // allocates memory
+    mem_node = get_tree_data(best_fit);
+    remove_hole(memory, mem_node);
+    best_fit = NULL;
+    split(process, mem_node, memory);
+
+    return 1;
+
+}
+
+/**
+ * Allocates memory from the largest hole if it is big enough
+ *
+ * @param memory Memory management data structure
+ * @param process Process to be allocated
+ * @return 1 if there is space, 0 if not
+ */
+static int worst_fit(memory_t *memory, process_t *process) {
+
+    rb_node_t *worst_fit = tree_max(memory->holes);
+    node_t *mem_node = NULL;
+
+    if (!worst_fit || ((block_t *) get_data(get_tree_data(worst_fit)))->size < get_mem_requirement(process)) {
+        return 0;
+    }
+
+    mem_node = get_tree_data(worst_fit);
+    remove_hole(memory, mem_node);
+    worst_fit = NULL;
+    split(process, mem_node, memory);
+
+    return 1;
+
+}
+
+/**
+ * Allocates memory from the lowest addressed hole that is big enough
+ *
+ * @param memory Memory management data structure
+ * @param process Process to be allocated
+ * @return 1 if there is space, 0 if not
+ */
+static int first_fit(memory_t *memory, process_t *process) {
+
+    uint64_t requirement = get_mem_requirement(process);
+    node_t *curr = get_head(memory->blocks);
+    block_t *curr_block;
+
+    while (curr) {
+        curr_block = (block_t *) get_data(curr);
+        if (curr_block->type == HOLE && curr_block->size >= requirement) {
+            remove_hole(memory, curr);
+            split(process, curr, memory);
+            return 1;
         }
         curr = get_next(curr);
     }
 
-    // allocates memory
-    if (is_space) {
-        delete_node(holes, best_fit);
-        mem_node = get_data(best_fit);
-        free(best_fit);
-        best_fit = NULL;
-        split(process, mem_node, holes, memory);
+    return 0;
+
+}
+
+/**
+ * Allocates memory from the first hole that is big enough, searching (and wrapping around) from where the last
+ * search finished
+ *
+ * @param memory Memory management data structure
+ * @param process Process to be allocated
+ * @return 1 if there is space, 0 if not
+ */
+static int next_fit(memory_t *memory, process_t *process) {
+
+    uint64_t requirement = get_mem_requirement(process);
+    node_t *start = memory->next_fit ? memory->next_fit : get_head(memory->blocks);
+    node_t *curr = start;
+    node_t *next;
+    block_t *curr_block;
+
+    do {
+        curr_block = (block_t *) get_data(curr);
+        if (curr_block->type == HOLE && curr_block->size >= requirement) {
+            remove_hole(memory, curr);
+            split(process, curr, memory);
+
+            // next search starts after the newly allocated block
+            next = get_next(get_block_node(process));
+            memory->next_fit = next ? next : get_head(memory->blocks);
+            return 1;
+        }
+        next = get_next(curr);
+        curr = next ? next : get_head(memory->blocks);
+    } while (curr != start);
+
+    return 0;
+
+}
+
+/**
+ * Checks if the largest hole is big enough for a given size
+ *
+ * @param memory Memory management data structure
+ * @param size Required size
+ * @return 1 if there is space, 0 if not
+ */
+static int hole_can_fit(memory_t *memory, uint64_t size) {
+
+    return memory->largest_free >= size;
+}
+
+/**
+ * Slides all process blocks down to the lowest addresses (keeping their order) so that free memory becomes a single
+ * hole at the end of memory
+ * Process blocks keep their memory nodes, so the block nodes held by processes remain valid
+ *
+ * @param memory Memory management data structure
+ */
+static void compact_holes(memory_t *memory) {
+
+    node_t *curr = get_head(memory->blocks);
+    node_t *next;
+    node_t *last_process = NULL;
+    block_t *curr_block;
+    uint64_t next_address = 0;
+
+    while (curr) {
+        next = get_next(curr);
+        curr_block = (block_t *) get_data(curr);
+
+        if (curr_block->type == HOLE) {
+            remove_hole(memory, curr);
+            delete_node(memory->blocks, curr);
+            free_block_node(memory, curr);
+        } else {
+            if (curr_block->start_address != next_address) {
+                memory->bytes_moved += curr_block->size;
+                curr_block->start_address = next_address;
+            }
+            next_address += curr_block->size;
+            last_process = curr;
+        }
+        curr = next;
     }
 
-    return is_space;
+    // next fit search starts from the only hole
+    block_t *hole = create_block(memory, HOLE, next_address, memory->capacity - next_address);
+    memory->next_fit = link_node(memory->blocks, &hole->node, last_process, NULL);
+    insert_hole(memory, memory->next_fit);
 
 }
 
@@ -126,19 +471,18 @@ static int best_fit(list_t *holes, list_t *memory, process_t *process) {
  *
  * @param process Process to be allocated
  * @param node Hole node to be split
- * @param holes List of holes
- * @param memory Memory allocation list
+ * @param memory Memory management data structure
  */
-static void split(process_t *process, node_t *node, list_t *holes, list_t *memory) {
+static void split(process_t *process, node_t *node, memory_t *memory) {
 
     // memory block from previous node
     block_t *old_block = (block_t *) get_data(node);
 
-    int prev_size = old_block->size;
-    int new_size = (int) get_value(process, MEMORY_REQUIREMENT);
-    int start_address = old_block->start_address;
+    uint64_t prev_size = old_block->size;
+    uint64_t new_size = get_mem_requirement(process);
+    uint64_t start_address = old_block->start_address;
     // block stored in new node
-    block_t *new_block = create_block(PROCESS, start_address, new_size);
+    block_t *new_block = create_block(memory, PROCESS, start_address, new_size);
 
     old_block->type = HOLE;
     old_block->start_address = start_address + new_size;
@@ -149,17 +493,17 @@ static void split(process_t *process, node_t *node, list_t *holes, list_t *memor
     // process fits perfectly in hole
     if (old_block->size == 0) {
 
-        delete_node(memory, node);
+        delete_node(memory->blocks, node);
         node_t *temp = node;
         node = get_next(node);
-        free_node(temp, free);
+        free_block_node(memory, temp);
 
     } else {
         // inserts the same node (but reduced in size) that was deleted in best_fit
-        insert_node_sorted(holes, node, (compare_func) compare_ints, (get_sort_value_func) get_size);
+        insert_hole(memory, node);
     }
 
-    node_t *new_node = insert_node(memory, new_block, prev_node, node);
+    node_t *new_node = link_node(memory->blocks, &new_block->node, prev_node, node);
     set_block_node(process, new_node);
 
 }
@@ -168,49 +512,68 @@ static void split(process_t *process, node_t *node, list_t *holes, list_t *memor
  * Deallocates the memory for a process once it is terminated
  *
  * @param process Process to be deallocated
- * @param memory Memory management list
- * @param holes List of holes
- * @param mem_strategy Memory strategy
+ * @param memory Memory management data structure
  */
-void deallocate_memory(process_t *process, list_t *memory, list_t *holes, char *mem_strategy) {
+void deallocate_memory(process_t *process, memory_t *memory) {
 
-    if (strcmp(mem_strategy, "infinity") == 0) {
+    // processes in infinite memory have nothing to free
+    if (memory->strategy->deallocate) {
+        memory->strategy->deallocate(memory, process);
+        set_block_node(process, NULL);
+        memory->epoch++;
+    }
 
-        return;
+}
 
-    } else if (strcmp(mem_strategy, "best-fit") == 0) {
+/**
+ * Loads a process that is about to run into memory (only paged memory loads processes when they run)
+ *
+ * @param memory Memory management data structure
+ * @param process Process about to run
+ * @param sim_time Simulation time
+ */
+void load_memory(memory_t *memory, process_t *process, uint32_t sim_time) {
 
-        node_t *block_node = get_block_node(process);
+    if (memory->strategy->load) {
+        memory->strategy->load(memory, process, sim_time);
+    }
 
-        ((block_t *) get_data(block_node))->type = HOLE;
+}
 
-        // check to right
-        if (get_next(block_node)) {
-            check_direction(memory, holes, block_node, (get_dir_func) get_next);
-        }
+/**
+ * Turns the block of a process into a hole, merging it with any adjacent holes
+ *
+ * @param memory Memory management data structure
+ * @param process Process whose block is to be freed
+ */
+static void free_hole(memory_t *memory, process_t *process) {
 
-        // check to left
-        if (get_prev(block_node)) {
-            check_direction(memory, holes, block_node, (get_dir_func) get_prev);
-        }
-        // need to delete holes from holes list when updating memory
-        insert_node_sorted(holes, block_node, (compare_func) compare_ints, (get_sort_value_func) get_size);
-        set_block_node(process, NULL);
+    node_t *block_node = get_block_node(process);
 
+    ((block_t *) get_data(block_node))->type = HOLE;
 
+    // check to right
+    if (get_next(block_node)) {
+        check_direction(memory, block_node, (get_dir_func) get_next);
     }
 
+    // check to left
+    if (get_prev(block_node)) {
+        check_direction(memory, block_node, (get_dir_func) get_prev);
+    }
+    // merged holes are removed from the hole index when updating memory
+    insert_hole(memory, block_node);
+
 }
 
 /**
  * Checks the adjacent memory blocks and merges if holes
  *
- * @param memory Memory management list
- * @param holes List of holes
+ * @param memory Memory management data structure
  * @param block_node Starting memory node
  * @param get_dir Function that determines which direction (left or right) to traverse
  */
-static void check_direction(list_t *memory, list_t *holes, node_t *block_node, get_dir_func get_dir) {
+static void check_direction(memory_t *memory, node_t *block_node, get_dir_func get_dir) {
 
     node_t *curr = get_dir(block_node);
     node_t *next;
@@ -219,7 +582,7 @@ static void check_direction(list_t *memory, list_t *holes, node_t *block_node, g
     while (curr_block->type == HOLE) {
         next = get_dir(curr);
         // merge hole with block node
-        update_memory(memory, holes, block_node, curr);
+        update_memory(memory, block_node, curr);
 
         curr = next;
 
@@ -235,105 +598,887 @@ static void check_direction(list_t *memory, list_t *holes, node_t *block_node, g
 /**
  * Merges the block node with the adjacent hole and updates memory
  *
- * @param memory Memory management list
- * @param holes List of holes
+ * @param memory Memory management data structure
  * @param main_node Memory block to be increased
  * @param adj_node Adjacent memory block to be merged
  */
-static void update_memory(list_t *memory, list_t *holes, node_t *main_node, node_t *adj_node) {
+static void update_memory(memory_t *memory, node_t *main_node, node_t *adj_node) {
 
     block_t *adj_block = (block_t *) get_data(adj_node);
     block_t *main_block = (block_t *) get_data(main_node);
-    int adj_start_address = adj_block->start_address;
-    int main_start_address = main_block->start_address;
+    uint64_t adj_start_address = adj_block->start_address;
+    uint64_t main_start_address = main_block->start_address;
 
     main_block->start_address = (adj_start_address < main_start_address) ? adj_start_address : main_start_address;
     main_block->size += adj_block->size;
 
-    // deletes the adjacent node from holes list and memory
-    delete_node(memory, adj_node);
-    delete_node_by_data(holes, adj_node, free);
+    // next fit search can no longer start from the merged node
+    if (memory->next_fit == adj_node) {
+        memory->next_fit = main_node;
+    }
+
+    // deletes the adjacent node from hole index and memory
+    remove_hole(memory, adj_node);
+    delete_node(memory->blocks, adj_node);
+    free_block_node(memory, adj_node);
+
+}
+
+/**
+ * Adds a hole to the hole index
+ *
+ * @param memory Memory management data structure
+ * @param block_node Memory node of hole
+ */
+static void insert_hole(memory_t *memory, node_t *block_node) {
+
+    block_t *block = (block_t *) get_data(block_node);
+
+    block->hole_id = memory->num_holes_created++;
+    block->hole_node = tree_insert(memory->holes, block_node);
+    memory->free_bytes += block->size;
+
+    if (block->size > memory->largest_free) {
+        memory->largest_free = block->size;
+    }
+}
+
+/**
+ * Removes a hole from the hole index using the handle stored in its block (no search needed)
+ *
+ * @param memory Memory management data structure
+ * @param block_node Memory node of hole
+ */
+static void remove_hole(memory_t *memory, node_t *block_node) {
+
+    block_t *block = (block_t *) get_data(block_node);
+
+    assert(block->hole_node);
+    tree_delete(memory->holes, block->hole_node);
+    block->hole_node = NULL;
+    memory->free_bytes -= block->size;
+
+    // finds the new largest hole if it was removed
+    if (block->size == memory->largest_free) {
+        rb_node_t *largest = tree_max(memory->holes);
+        memory->largest_free = largest ? ((block_t *) get_data(get_tree_data(largest)))->size : 0;
+    }
+}
+
+/**
+ * Carves the block covering all of memory into aligned power of two blocks (largest first) and adds them to the
+ * buddy free lists, so a capacity that is not a power of two is still fully used
+ *
+ * @param memory Memory management data structure
+ * @param block_node Memory node of initial block
+ */
+static void init_buddy(memory_t *memory, node_t *block_node) {
+
+    block_t *block = (block_t *) get_data(block_node);
+    uint64_t remaining = block->size;
+    int order = memory->max_order;
+
+    block->size = ORDER_SIZE(order);
+    remaining -= block->size;
+    insert_free_block(memory, block_node, order);
+
+    // each following block starts at a multiple of its size as all previous blocks are larger powers of two
+    while (remaining > 0) {
+        while (ORDER_SIZE(order) > remaining) {
+            order--;
+        }
+
+        block_t *next_block = create_block(memory, HOLE, block->start_address + block->size, ORDER_SIZE(order));
+        block_node = link_node(memory->blocks, &next_block->node, block_node, NULL);
+        block = next_block;
+        remaining -= block->size;
+        insert_free_block(memory, block_node, order);
+    }
+
+}
+
+/**
+ * Checks if there is a large enough free buddy block and if so allocates it, splitting it down to the
+ * smallest power of two that holds the process
+ *
+ * @param memory Memory management data structure
+ * @param process Process to be allocated
+ * @return 1 if there is space, 0 if not
+ */
+static int buddy_fit(memory_t *memory, process_t *process) {
+
+    uint64_t requirement = get_mem_requirement(process);
+    int order = get_order(requirement);
+    int curr_order = order;
+
+    // smallest order with a free block
+    while (curr_order <= memory->max_order && is_empty_list(memory->free_lists[curr_order])) {
+        curr_order++;
+    }
+
+    if (curr_order > memory->max_order) {
+        return 0;
+    }
+
+    node_t *block_node = get_data(get_head(memory->free_lists[curr_order]));
+    block_t *block = (block_t *) get_data(block_node);
+    remove_free_block(memory, block_node, curr_order);
+
+    // halves the block until it is the required order, freeing the upper halves
+    while (curr_order > order) {
+        curr_order--;
+        block->size /= 2;
+
+        block_t *buddy = create_block(memory, HOLE, block->start_address + block->size, block->size);
+        node_t *buddy_node = link_node(memory->blocks, &buddy->node, block_node, get_next(block_node));
+        insert_free_block(memory, buddy_node, curr_order);
+    }
+
+    block->type = PROCESS;
+    memory->bytes_requested += requirement;
+    memory->bytes_allocated += block->size;
+    set_block_node(process, block_node);
+
+    return 1;
 
 }
 
+/**
+ * Checks if there is a free buddy block of at least a given size
+ *
+ * @param memory Memory management data structure
+ * @param size Required size
+ * @return 1 if there is space, 0 if not
+ */
+static int buddy_can_fit(memory_t *memory, uint64_t size) {
+
+    return memory->largest_free >= size;
+}
 
 /**
- * Initialises memory and holes to 2048 Bytes
+ * Frees the buddy block of a process and merges it with its buddy for as long as the buddy is also free
  *
- * @param memory Memory management list
- * @param holes List of holes
+ * @param memory Memory management data structure
+ * @param process Process whose block is to be freed
  */
-void initialise_memory(list_t *memory, list_t *holes) {
+static void buddy_free(memory_t *memory, process_t *process) {
+
+    node_t *block_node = get_block_node(process);
+    block_t *block = (block_t *) get_data(block_node);
+    int order = get_order(block->size);
+    node_t *buddy_node;
+    block_t *buddy;
+
+    block->type = HOLE;
+
+    while (order < memory->max_order) {
+
+        // buddy is to the left if this block is the upper half of its parent (always adjacent in memory)
+        buddy_node = (block->start_address & block->size) ? get_prev(block_node) : get_next(block_node);
+        if (!buddy_node) {
+            break;
+        }
+
+        // buddy is free only if it has not been split
+        buddy = (block_t *) get_data(buddy_node);
+        if (buddy->type != HOLE || buddy->size != block->size) {
+            break;
+        }
 
-    block_t *init_hole = create_block(HOLE, 0, MEM_CAPACITY);
-    enqueue(memory, init_hole);
-    enqueue(holes, get_head(memory));
+        remove_free_block(memory, buddy_node, order);
+        block->start_address = (buddy->start_address < block->start_address) ? buddy->start_address : block->start_address;
+        block->size *= 2;
+        delete_node(memory->blocks, buddy_node);
+        free_block_node(memory, buddy_node);
+
+        order++;
+    }
+
+    insert_free_block(memory, block_node, order);
+
+}
+
+/**
+ * Pushes a block onto the front of the buddy free list for its order
+ *
+ * @param memory Memory management data structure
+ * @param block_node Memory node of free block
+ * @param order Order of block
+ */
+static void insert_free_block(memory_t *memory, node_t *block_node, int order) {
+
+    list_t *free_list = memory->free_lists[order];
+
+    ((block_t *) get_data(block_node))->free_node = insert_node(free_list, block_node, NULL, get_head(free_list));
+
+    if (ORDER_SIZE(order) > memory->largest_free) {
+        memory->largest_free = ORDER_SIZE(order);
+    }
+}
+
+/**
+ * Removes a block from the buddy free list for its order using the handle stored in its block
+ *
+ * @param memory Memory management data structure
+ * @param block_node Memory node of free block
+ * @param order Order of block
+ */
+static void remove_free_block(memory_t *memory, node_t *block_node, int order) {
+
+    block_t *block = (block_t *) get_data(block_node);
+
+    assert(block->free_node);
+    delete_node(memory->free_lists[order], block->free_node);
+    free_node(block->free_node, blank);
+    block->free_node = NULL;
+
+    // finds the new largest order with a free block if the last one was removed
+    if (ORDER_SIZE(order) == memory->largest_free && is_empty_list(memory->free_lists[order])) {
+        while (order >= 0 && is_empty_list(memory->free_lists[order])) {
+            order--;
+        }
+        memory->largest_free = (order >= 0) ? ORDER_SIZE(order) : 0;
+    }
+}
+
+/**
+ * Splits memory into frames (the initial block is only used by contiguous strategies)
+ *
+ * @param memory Memory management data structure
+ * @param block_node Memory node covering all of memory
+ */
+static void init_frames(memory_t *memory, node_t *block_node) {
+
+    memory->num_frames = memory->capacity / FRAME_SIZE;
+    memory->free_frames = memory->num_frames;
+}
+
+/**
+ * Gives a process an empty page table, pages are only loaded into frames once the process runs
+ *
+ * @param memory Memory management data structure
+ * @param process Process to be allocated
+ * @return 1 as processes never wait for frames before becoming ready
+ */
+static int page_fit(memory_t *memory, process_t *process) {
+
+    page_table_t *page_table = malloc(sizeof(*page_table));
+    assert(page_table);
+
+    page_table->process = process;
+    page_table->num_pages = (get_mem_requirement(process) + FRAME_SIZE - 1) / FRAME_SIZE;
+    page_table->num_resident = 0;
+    page_table->page_faults = 0;
+    page_table->evicted_frames = 0;
+    page_table->lru_node = NULL;
+
+    enqueue(memory->page_tables, page_table);
+    set_page_table(process, page_table);
+
+    return 1;
+
+}
+
+/**
+ * Checks if memory has enough frames for the minimum resident set of a process
+ *
+ * @param memory Memory management data structure
+ * @param size Required size
+ * @return 1 if there are enough frames, 0 if not
+ */
+static int page_can_fit(memory_t *memory, uint64_t size) {
+
+    uint64_t num_pages = (size + FRAME_SIZE - 1) / FRAME_SIZE;
+
+    return (num_pages < MIN_RESIDENT_PAGES ? num_pages : MIN_RESIDENT_PAGES) <= memory->num_frames;
+}
+
+/**
+ * Frees the frames of a terminated process
+ *
+ * @param memory Memory management data structure
+ * @param process Process whose frames are to be freed
+ */
+static void free_pages(memory_t *memory, process_t *process) {
+
+    page_table_t *page_table = get_page_table(process);
+
+    remove_lru(memory, page_table);
+    memory->free_frames += page_table->num_resident;
+    page_table->num_resident = 0;
+
+}
+
+/**
+ * Loads the pages of a process that is about to run, evicting the least recently run processes until its minimum
+ * resident set fits, and then loading as many of its other pages as there are free frames
+ * Each page loaded counts as a page fault
+ *
+ * @param memory Memory management data structure
+ * @param process Process about to run
+ * @param sim_time Simulation time
+ */
+static void load_pages(memory_t *memory, process_t *process, uint32_t sim_time) {
+
+    page_table_t *page_table = get_page_table(process);
+    uint64_t min_resident = page_table->num_pages < MIN_RESIDENT_PAGES ? page_table->num_pages : MIN_RESIDENT_PAGES;
+    uint64_t num_loaded;
+    node_t *victim;
+
+    // process is taken out of the least recently run list so it never evicts itself
+    remove_lru(memory, page_table);
+
+    while (page_table->num_resident + memory->free_frames < min_resident) {
+        // all frames that are not free belong to processes in the list, so it cannot run out
+        assert(!is_empty_list(memory->lru));
+        // processes running on other CPUs are only evicted if every resident process is running
+        victim = get_head(memory->lru);
+        while (victim && get_state(((page_table_t *) get_data(victim))->process) == RUNNING) {
+            victim = get_next(victim);
+        }
+        if (!victim) {
+            victim = get_head(memory->lru);
+        }
+        evict_pages(memory, (page_table_t *) get_data(victim), sim_time);
+    }
+
+    num_loaded = page_table->num_pages - page_table->num_resident;
+    if (num_loaded > memory->free_frames) {
+        num_loaded = memory->free_frames;
+    }
+    page_table->num_resident += num_loaded;
+    memory->free_frames -= num_loaded;
+    page_table->page_faults += num_loaded;
+    memory->page_faults += num_loaded;
+
+    // process is now the most recently run
+    page_table->lru_node = insert_node(memory->lru, page_table, get_tail(memory->lru), NULL);
+
+}
+
+/**
+ * Evicts all resident pages of a process and prints status
+ *
+ * @param memory Memory management data structure
+ * @param page_table Page table of process to be evicted
+ * @param sim_time Simulation time
+ */
+static void evict_pages(memory_t *memory, page_table_t *page_table, uint32_t sim_time) {
+
+    printf("%u,EVICTED,process_name=%s,frames=%" PRIu64 "\n", sim_time, get_name(page_table->process),
+           page_table->num_resident);
+
+    remove_lru(memory, page_table);
+    memory->free_frames += page_table->num_resident;
+    page_table->evicted_frames += page_table->num_resident;
+    memory->evicted_frames += page_table->num_resident;
+    page_table->num_resident = 0;
+
+}
+
+/**
+ * Removes a page table from the least recently run list if it is in the list
+ *
+ * @param memory Memory management data structure
+ * @param page_table Specified page table
+ */
+static void remove_lru(memory_t *memory, page_table_t *page_table) {
+
+    if (page_table->lru_node) {
+        delete_node(memory->lru, page_table->lru_node);
+        free_node(page_table->lru_node, blank);
+        page_table->lru_node = NULL;
+    }
+}
+
+/**
+ * Creates the allocation bitmap with all units free (the initial block is only used by list based strategies)
+ *
+ * @param memory Memory management data structure
+ * @param block_node Memory node covering all of memory
+ */
+static void init_bitmap(memory_t *memory, node_t *block_node) {
+
+    memory->unit_shift = 0;
+    while ((memory->capacity >> memory->unit_shift) > MAX_BITMAP_UNITS) {
+        memory->unit_shift++;
+    }
+
+    memory->num_units = memory->capacity >> memory->unit_shift;
+    memory->free_units = memory->num_units;
+    // bits past the last unit stay allocated so runs never extend beyond memory
+    memory->bitmap = calloc((memory->num_units + WORD_BITS - 1) / WORD_BITS, sizeof(*memory->bitmap));
+    assert(memory->bitmap);
+    set_units(memory, 0, memory->num_units, 1);
+
+}
+
+/**
+ * Allocates the lowest addressed run of free units that is big enough for a process
+ *
+ * @param memory Memory management data structure
+ * @param process Process to be allocated
+ * @return 1 if there is space, 0 if not
+ */
+static int bitmap_fit(memory_t *memory, process_t *process) {
+
+    uint64_t unit_size = (uint64_t) 1 << memory->unit_shift;
+    uint64_t length = (get_mem_requirement(process) + unit_size - 1) >> memory->unit_shift;
+    uint64_t start = find_free_run(memory, length);
+
+    if (start == NO_FREE_RUN) {
+        return 0;
+    }
+
+    set_units(memory, start, length, 0);
+    memory->free_units -= length;
+
+    // the block is not part of the block list, it only records the address for the process
+    block_t *block = create_block(memory, PROCESS, start << memory->unit_shift, length << memory->unit_shift);
+    set_block_node(process, &block->node);
+
+    return 1;
+
+}
+
+/**
+ * Checks if there are enough free units in total for a given size (the units may not be contiguous)
+ *
+ * @param memory Memory management data structure
+ * @param size Required size
+ * @return 1 if there could be space, 0 if not
+ */
+static int bitmap_can_fit(memory_t *memory, uint64_t size) {
+
+    uint64_t unit_size = (uint64_t) 1 << memory->unit_shift;
+
+    return ((size + unit_size - 1) >> memory->unit_shift) <= memory->free_units;
+}
+
+/**
+ * Marks the units of a terminated process as free
+ *
+ * @param memory Memory management data structure
+ * @param process Process whose units are to be freed
+ */
+static void bitmap_free(memory_t *memory, process_t *process) {
+
+    node_t *block_node = get_block_node(process);
+    block_t *block = (block_t *) get_data(block_node);
+    uint64_t length = block->size >> memory->unit_shift;
+
+    set_units(memory, block->start_address >> memory->unit_shift, length, 1);
+    memory->free_units += length;
+    free_block_node(memory, block_node);
+
+}
+
+/**
+ * Finds the lowest addressed run of free units of at least a given length a word at a time
+ * Free and allocated words are skipped whole, and runs within a word are found by counting trailing and leading bits
+ *
+ * @param memory Memory management data structure
+ * @param length Number of units needed
+ * @return First unit of the run or NO_FREE_RUN if there is none
+ */
+static uint64_t find_free_run(memory_t *memory, uint64_t length) {
+
+    uint64_t num_words = (memory->num_units + WORD_BITS - 1) / WORD_BITS;
+    uint64_t run_start = 0, run_length = 0;
+    uint64_t word;
+    int bit, num_free;
+
+    for (uint64_t i = 0; i < num_words; i++) {
+        word = memory->bitmap[i];
+
+        if (word == FULL_WORD) {
+            if (run_length == 0) {
+                run_start = i * WORD_BITS;
+            }
+            run_length += WORD_BITS;
+            if (run_length >= length) {
+                return run_start;
+            }
+            continue;
+        }
+
+        // free units at the bottom of the word continue the current run
+        num_free = __builtin_ctzll(~word);
+        if (run_length == 0) {
+            run_start = i * WORD_BITS;
+        }
+        if (run_length + num_free >= length) {
+            return run_start;
+        }
+
+        // runs in the middle of the word are too short for requests longer than a word
+        if (length <= WORD_BITS) {
+            bit = num_free;
+            while (bit < WORD_BITS && (word >> bit)) {
+                // skips allocated units then counts the free units after them
+                bit += __builtin_ctzll(word >> bit);
+                num_free = __builtin_ctzll(~(word >> bit));
+                if (num_free >= length) {
+                    return i * WORD_BITS + bit;
+                }
+                bit += num_free;
+            }
+        }
+
+        // only the free units at the top of the word can start a run continuing into the next word
+        num_free = __builtin_clzll(~word);
+        run_start = (i + 1) * WORD_BITS - num_free;
+        run_length = num_free;
+    }
+
+    return NO_FREE_RUN;
+}
+
+/**
+ * Marks a run of units as free or allocated, setting whole words at once where possible
+ *
+ * @param memory Memory management data structure
+ * @param start First unit of the run
+ * @param length Number of units in the run
+ * @param is_free 1 to mark the units free, 0 to mark them allocated
+ */
+static void set_units(memory_t *memory, uint64_t start, uint64_t length, int is_free) {
+
+    uint64_t end = start + length;
+    uint64_t *word;
+    uint64_t mask;
+    int bit;
+
+    while (start < end) {
+        word = &memory->bitmap[start / WORD_BITS];
+        bit = start % WORD_BITS;
+        // units from bit up to the end of the run or the word
+        if (end - start >= WORD_BITS - bit) {
+            mask = FULL_WORD << bit;
+            start += WORD_BITS - bit;
+        } else {
+            mask = (((uint64_t) 1 << (end - start)) - 1) << bit;
+            start = end;
+        }
+
+        *word = is_free ? (*word | mask) : (*word & ~mask);
+    }
+
+}
+
+/**
+ * Gets the order of the smallest power of two that is greater than or equal to a size
+ *
+ * @param size Size in Bytes
+ * @return Order k where 2^k >= size (MAX_ORDERS if there is no such 64 bit power of two)
+ */
+static int get_order(uint64_t size) {
+
+    int order = 0;
+
+    while (order < MAX_ORDERS && ORDER_SIZE(order) < size) {
+        order++;
+    }
+
+    return order;
+}
+
+/**
+ * Initialises memory and holes to the memory capacity
+ *
+ * @param mem_strategy Name of memory strategy
+ * @param capacity Memory capacity in Bytes
+ * @return Memory management data structure
+ */
+memory_t *initialise_memory(char *mem_strategy, uint64_t capacity) {
+
+    const mem_strategy_t *strategy = NULL;
+
+    // resolves strategy once so that it is not looked up every cycle
+    for (int i = 0; i < NUM_STRATEGIES; i++) {
+        if (strcmp(mem_strategy, strategies[i].name) == 0) {
+            strategy = &strategies[i];
+            break;
+        }
+    }
+
+    if (!strategy) {
+        fprintf(stderr, "Unknown memory strategy: %s\n", mem_strategy);
+        exit(EXIT_FAILURE);
+    }
+
+    memory_t *memory = malloc(sizeof(*memory));
+    assert(memory);
+
+    memory->strategy = strategy;
+    memory->next_fit = NULL;
+    memory->largest_free = 0;
+    memory->free_bytes = 0;
+    memory->compaction = 0;
+    memory->compaction_cost = 0;
+    memory->num_compactions = 0;
+    memory->bytes_moved = 0;
+    memory->pending_stall = 0;
+    memory->compaction_time = 0;
+    memory->num_frames = 0;
+    memory->free_frames = 0;
+    memory->page_tables = create_empty_list();
+    memory->lru = create_empty_list();
+    memory->page_faults = 0;
+    memory->evicted_frames = 0;
+    memory->bitmap = NULL;
+    memory->num_units = 0;
+    memory->free_units = 0;
+    memory->unit_shift = 0;
+    memory->epoch = 0;
+    memory->checked_epoch = 0;
+    memory->last_checked = NULL;
+    memory->batch = NULL;
+    memory->batch_size = 0;
+    memory->batch_capacity = 0;
+
+    memory->blocks = create_empty_list();
+    memory->block_pool = create_pool(sizeof(block_t));
+    memory->holes = create_tree((tree_compare_func) compare_holes);
+    memory->num_holes_created = 0;
+    memory->capacity = capacity;
+    // largest power of two that fits in memory
+    memory->max_order = get_order(capacity);
+    if (memory->max_order == MAX_ORDERS || ORDER_SIZE(memory->max_order) > capacity) {
+        memory->max_order--;
+    }
+    memory->bytes_requested = 0;
+    memory->bytes_allocated = 0;
+
+    memory->free_lists = malloc((memory->max_order + 1) * sizeof(*memory->free_lists));
+    assert(memory->free_lists);
+    for (int order = 0; order <= memory->max_order; order++) {
+        memory->free_lists[order] = create_empty_list();
+    }
+
+    block_t *init_hole = create_block(memory, HOLE, 0, capacity);
+    enqueue_node(memory->blocks, &init_hole->node);
+
+    // whole memory starts as a single free block
+    strategy->init(memory, get_head(memory->blocks));
+
+    return memory;
+}
+
+/**
+ * Enables compaction of holes when a waiting process would fit in the total free memory but not in any single hole
+ * (only for strategies using holes, as buddy blocks must stay aligned)
+ *
+ * @param memory Memory management data structure
+ * @param cost_per_byte Time units it takes to move one Byte of memory
+ */
+void enable_compaction(memory_t *memory, double cost_per_byte) {
+
+    memory->compaction = 1;
+    memory->compaction_cost = cost_per_byte;
+}
+
+/**
+ * Takes the time the CPUs must stall for the compactions since it was last called, rounded up to whole cycles, and
+ * adds it to the compaction time
+ *
+ * @param memory Memory management data structure
+ * @param quantum Amount of time per cycle
+ * @return Time to stall for (0 if memory has not been compacted)
+ */
+uint64_t take_compaction_stall(memory_t *memory, int quantum) {
+
+    uint64_t stall = (memory->pending_stall + quantum - 1) / quantum * quantum;
+
+    memory->pending_stall = 0;
+    memory->compaction_time += stall;
+
+    return stall;
+
+}
+
+/**
+ * Frees memory management data structure and all of its blocks
+ *
+ * @param memory Memory to be freed
+ */
+void free_memory(memory_t *memory) {
+
+    free_tree(memory->holes, blank);
+    for (int order = 0; order <= memory->max_order; order++) {
+        free_list(memory->free_lists[order], blank);
+    }
+    free(memory->free_lists);
+    free_list(memory->lru, blank);
+    free_list(memory->page_tables, free);
+    free(memory->bitmap);
+    free(memory->batch);
+    free_intrusive_list(memory->blocks, blank);
+    free_pool(memory->block_pool);
+    free(memory);
+    memory = NULL;
 }
 
 /**
  * Creates a memory block
  *
+ * @param memory Memory management data structure (owner of the block pool)
  * @param type Type of memory block (hole or process)
  * @param start Starting memory address
  * @param size Size of memory block in Bytes
  * @return The newly created block
  */
-static block_t *create_block(block_type_t type, int start, int size) {
+static block_t *create_block(memory_t *memory, block_type_t type, uint64_t start, uint64_t size) {
 
-    block_t *block = malloc(sizeof(*block));
-    assert(block);
+    block_t *block = pool_alloc(memory->block_pool);
 
     block->type = type;
     block->size = size;
     block->start_address = start;
+    block->hole_id = 0;
+    block->hole_node = NULL;
+    block->free_node = NULL;
+    init_node(&block->node, block);
 
     return block;
 }
 
 /**
- * Adds the process to ready queue and prints status
+ * Frees a memory node (that has already been removed from memory) with the block it is embedded in
+ *
+ * @param memory Memory management data structure
+ * @param block_node Memory node to be freed
+ */
+static void free_block_node(memory_t *memory, node_t *block_node) {
+
+    pool_free(memory->block_pool, get_data(block_node));
+}
+
+/**
+ * Gets the largest number of memory blocks that existed at once
+ *
+ * @param memory Memory management data structure
+ * @return Peak number of blocks
+ */
+int get_peak_blocks(memory_t *memory) {
+
+    return get_pool_peak(memory->block_pool);
+}
+
+/**
+ * Prints the statistics specific to the memory strategy
+ *
+ * @param memory Memory management data structure
+ */
+void print_memory_statistics(memory_t *memory) {
+
+    if (memory->strategy->print_stats) {
+        memory->strategy->print_stats(memory);
+    }
+
+    if (memory->compaction && memory->strategy->compact) {
+        printf("Compactions %lu\n", memory->num_compactions);
+        printf("Bytes moved %" PRIu64 "\n", memory->bytes_moved);
+        printf("Compaction time %" PRIu64 "\n", memory->compaction_time);
+    }
+
+}
+
+/**
+ * Prints the internal fragmentation of the buddy system
  *
+ * @param memory Memory management data structure
+ */
+static void print_buddy_statistics(memory_t *memory) {
+
+    // fraction of allocated Bytes that were not requested
+    double fragmentation = memory->bytes_allocated ?
+            1 - (double) memory->bytes_requested / memory->bytes_allocated : 0;
+    printf("Internal fragmentation %.2lf\n", round(fragmentation * 100) / 100);
+
+}
+
+/**
+ * Prints the total and per process page faults and evicted frames of paged memory
+ *
+ * @param memory Memory management data structure
+ */
+static void print_paging_statistics(memory_t *memory) {
+
+    page_table_t *page_table;
+
+    printf("Page faults %lu\n", memory->page_faults);
+    printf("Evicted frames %lu\n", memory->evicted_frames);
+
+    for (node_t *curr = get_head(memory->page_tables); curr; curr = get_next(curr)) {
+        page_table = (page_table_t *) get_data(curr);
+        printf("process_name=%s,page_faults=%lu,evicted_frames=%lu\n", get_name(page_table->process),
+               page_table->page_faults, page_table->evicted_frames);
+    }
+
+}
+
+/**
+ * Adds the process to the batch of processes to be inserted into the ready queue and prints status
+ *
+ * @param memory Memory management data structure (owner of the batch)
  * @param process Ready process
- * @param ready Ready queue
  * @param sim_time Current simulation time
- * @param mem_strategy Memory Strategy
- * @param insert Insertion function for ready queue depending on scheduling algorithm
  */
-static void process_ready(process_t *process, void *ready, uint32_t sim_time, char *mem_strategy, insert_func insert) {
+static void process_ready(memory_t *memory, process_t *process, uint32_t sim_time) {
 
     set_state(process, READY);
-    insert(ready, process);
-    if (strcmp(mem_strategy, "best-fit") == 0) {
-        printf("%u,READY,process_name=%s,assigned_at=%d\n", sim_time, get_name(process),
+    if (memory->batch_size >= memory->batch_capacity) {
+        memory->batch_capacity = memory->batch_capacity ? 2 * memory->batch_capacity : INIT_BATCH_SIZE;
+        memory->batch = realloc(memory->batch, memory->batch_capacity * sizeof(*memory->batch));
+        assert(memory->batch);
+    }
+    memory->batch[memory->batch_size++] = process;
+    // only processes given a block have an address
+    if (get_block_node(process)) {
+        printf("%u,READY,process_name=%s,assigned_at=%" PRIu64 "\n", sim_time, get_name(process),
                ((block_t *) get_data(get_block_node(process)))->start_address);
     }
 
 }
 
 /**
- * Compares two ints - used to compare block sizes when inserting block into holes list
+ * Compares two holes by size and then by newest first - used to order the hole index
  *
- * @param int1 Pointer to int
- * @param int2 Pointer to int
- * @return Returns 1, 0 or -1 depending on relative int values
+ * @param hole1 Memory node of hole
+ * @param hole2 Memory node of hole
+ * @return Returns 1, 0 or -1 depending on relative hole order
  */
-int compare_ints(int *int1, int *int2) {
+static int compare_holes(node_t *hole1, node_t *hole2) {
 
-    if (*int1 > *int2) {
-        return 1;
-    } else if (*int1 < *int2) {
-        return -1;
+    block_t *block1 = (block_t *) get_data(hole1);
+    block_t *block2 = (block_t *) get_data(hole2);
+
+    if (block1->size != block2->size) {
+        return (block1->size > block2->size) ? 1 : -1;
+    } else if (block1->hole_id != block2->hole_id) {
+        return (block1->hole_id < block2->hole_id) ? 1 : -1;
     } else {
         return 0;
     }
 }
 
 /**
- * Gets size of block
+ * Compares the size of a hole with a required size - used to find the best fit in the hole index
  *
- * @param block Specified block
- * @return Size of block
+ * @param hole Memory node of hole
+ * @param size Pointer to required size
+ * @return Returns 1, 0 or -1 depending on relative sizes
  */
-int *get_size(block_t *block) {
-    return &block->size;
+static int compare_hole_size(node_t *hole, uint64_t *size) {
+
+    uint64_t hole_size = ((block_t *) get_data(hole))->size;
+
+    if (hole_size > *size) {
+        return 1;
+    } else if (hole_size < *size) {
+        return -1;
+    } else {
+        return 0;
+    }
 }
@@ -7,67 +7,99 @@
 #ifndef MEMORY_ALLOCATION_H
 #define MEMORY_ALLOCATION_H
 
+// default memory capacity in Bytes (can be changed with -M)
 #define MEM_CAPACITY 2048
 
 #include <stdint.h>
 
 typedef enum state state_t;
 typedef struct block block_t;
+typedef struct memory memory_t;
+typedef struct mem_strategy mem_strategy_t;
 typedef enum block_type block_type_t;
 typedef struct list list_t;
 typedef struct node node_t;
 typedef struct process process_t;
-typedef int (*insert_func)(void *, process_t *);
+typedef void (*insert_func)(void *, process_t **, int);
 
 
 /**
  * Allocates memory to a process depending on the memory strategy
  *
  * @param memory Memory management data structure
- * @param holes List of free memory blocks (nodes of memory)
  * @param input List of unallocated and arrived processes
  * @param ready List of allocated processes (data structure depending on scheduling algorithm)
- * @param mem_strategy Memory allocation strategy
  * @param sim_time Simulation time
- * @param insert Function to insert process into ready queue
+ * @param insert Function to insert all processes allocated in the call into the ready queue at once
  * @return Ready queue
  */
-void *allocate_memory(list_t *memory, list_t *holes, list_t *input, void *ready, char *mem_strategy, uint32_t sim_time,
-                      insert_func insert);
+void *allocate_memory(memory_t *memory, list_t *input, void *ready, uint32_t sim_time, insert_func insert);
 
 /**
  * Deallocates the memory for a process once it is terminated
  *
  * @param process Process to be deallocated
- * @param memory Memory management list
- * @param holes List of holes
- * @param mem_strategy Memory strategy
+ * @param memory Memory management data structure
+ */
+void deallocate_memory(process_t *process, memory_t *memory);
+
+/**
+ * Loads a process that is about to run into memory (only paged memory loads processes when they run)
+ *
+ * @param memory Memory management data structure
+ * @param process Process about to run
+ * @param sim_time Simulation time
  */
-void deallocate_memory(process_t *process, list_t *memory, list_t *holes, char *mem_strategy);
+void load_memory(memory_t *memory, process_t *process, uint32_t sim_time);
 
 /**
- * Initialises memory and holes to 2048 Bytes
+ * Initialises memory and holes to the memory capacity (exits if the memory strategy is unknown)
  *
- * @param memory Memory management list
- * @param holes List of holes
+ * @param mem_strategy Name of memory strategy (infinite, best-fit, worst-fit, first-fit, next-fit, buddy, virtual or bitmap)
+ * @param capacity Memory capacity in Bytes
+ * @return Memory management data structure
  */
-void initialise_memory(list_t *memory, list_t *holes);
+memory_t *initialise_memory(char *mem_strategy, uint64_t capacity);
 
 /**
- * Gets size of block
+ * Enables compaction of holes when a waiting process would fit in the total free memory but not in any single hole
+ * (only for strategies using holes, as buddy blocks must stay aligned)
  *
- * @param block Specified block
- * @return Size of block
+ * @param memory Memory management data structure
+ * @param cost_per_byte Time units it takes to move one Byte of memory
  */
-int *get_size(block_t *block);
+void enable_compaction(memory_t *memory, double cost_per_byte);
 
 /**
- * Compares two ints - used to compare block sizes when inserting block into holes list
+ * Takes the time the CPUs must stall for the compactions since it was last called, rounded up to whole cycles, and
+ * adds it to the compaction time
  *
- * @param int1 Pointer to int
- * @param int2 Pointer to int
- * @return Returns 1, 0 or -1 depending on relative int values
+ * @param memory Memory management data structure
+ * @param quantum Amount of time per cycle
+ * @return Time to stall for (0 if memory has not been compacted)
+ */
+uint64_t take_compaction_stall(memory_t *memory, int quantum);
+
+/**
+ * Frees memory management data structure and all of its blocks
+ *
+ * @param memory Memory to be freed
+ */
+void free_memory(memory_t *memory);
+
+/**
+ * Gets the largest number of memory blocks that existed at once
+ *
+ * @param memory Memory management data structure
+ * @return Peak number of blocks
+ */
+int get_peak_blocks(memory_t *memory);
+
+/**
+ * Prints the statistics specific to the memory strategy
+ *
+ * @param memory Memory management data structure
  */
-int compare_ints(int *int1, int *int2);
+void print_memory_statistics(memory_t *memory);
 
 #endif
@@ -11,34 +11,78 @@
 #include "min_heap.h"
 #include "process_data.h"
 
-/* Definition of min heap data structure */
+/* Definition of min heap data structure, a HEAP_ARITY-ary heap of data elements with their keys */
+typedef struct heap_entry {
+    uint64_t key;
+    void *data;
+} heap_entry_t;
+
 struct min_heap {
-    void **data;
+    heap_entry_t *entries;
     int num_items;
     int capacity;
+    // compare only breaks ties between equal keys
+    heap_compare_func compare;
+    heap_key_func key;
+    // whether each process stores its index in the heap (so it can be updated or removed)
+    int indexed;
 };
 
-static void up_heap(min_heap_t *heap, int index, int (compare)(void *, void *));
-static void down_heap(min_heap_t *heap, int index, int (compare)(void *, void *));
-static void swap(void **p1, void **p2);
-
-typedef int (*compare_func)(void *, void *);
+static int precedes(min_heap_t *heap, heap_entry_t *entry1, heap_entry_t *entry2);
+static void place(min_heap_t *heap, int index, heap_entry_t entry);
+static void up_heap(min_heap_t *heap, int index);
+static void down_heap(min_heap_t *heap, int index);
+static void fix_heap(min_heap_t *heap, int index);
 
 
 /**
- * This function creates an empty min heap of size 2
+ * This function creates an empty min heap of size 2, ordered by SJF key and then compare_process
  *
  * @return An empty heap
  */
 min_heap_t *create_heap() {
 
+    return create_ordered_heap((heap_compare_func) compare_process, (heap_key_func) get_sjf_key);
+}
+
+/**
+ * Creates an empty min heap ordered by a key and then the given function instead of compare_process
+ * The key of each data element is stored next to it, so most comparisons do not dereference the data
+ *
+ * @param compare Function that orders data elements with equal keys
+ * @param key Function giving the key of a data element, which must order them the same way as compare (NULL if
+ * compare alone orders them)
+ * @return An empty heap
+ */
+min_heap_t *create_ordered_heap(heap_compare_func compare, heap_key_func key) {
+
     min_heap_t *heap = malloc(sizeof(*heap));
     assert(heap);
     // allocates memory for data in heap
-    heap->data = malloc(INIT_SIZE * sizeof(*heap->data));
-    assert(heap->data);
+    heap->entries = malloc(INIT_SIZE * sizeof(*heap->entries));
+    assert(heap->entries);
     heap->num_items = 0;
     heap->capacity = INIT_SIZE;
+    heap->compare = compare;
+    heap->key = key;
+    heap->indexed = 0;
+
+    return heap;
+
+}
+
+/**
+ * Creates an empty min heap of processes in which each process stores its index, so that a process can be moved
+ * when its key changes or removed from anywhere in the heap
+ *
+ * @param compare Function that orders processes with equal keys
+ * @param key Function giving the key of a process (NULL if compare alone orders them)
+ * @return An empty indexed heap
+ */
+min_heap_t *create_indexed_heap(heap_compare_func compare, heap_key_func key) {
+
+    min_heap_t *heap = create_ordered_heap(compare, key);
+    heap->indexed = 1;
 
     return heap;
 
@@ -54,15 +98,66 @@ void insert_data(min_heap_t *heap, void *data) {
 
     if (heap->num_items >= heap->capacity) {
         heap->capacity *= 2;
-        heap->data = realloc(heap->data, heap->capacity * sizeof(data));
-        assert(heap->data);
+        heap->entries = realloc(heap->entries, heap->capacity * sizeof(*heap->entries));
+        assert(heap->entries);
 
     }
-    heap->data[heap->num_items++] = data;
+    heap->entries[heap->num_items].key = heap->key ? heap->key(data) : 0;
+    heap->entries[heap->num_items].data = data;
+    if (heap->indexed) {
+        set_heap_index(data, heap->num_items);
+    }
+    heap->num_items++;
 
-    // fixes heap (need to use specific comparison function here as num_args(insert_data) == num_args(enqueue))
-    up_heap(heap, heap->num_items - 1, (compare_func) compare_process);
+    // fixes heap (comparison function is stored in the heap as num_args(insert_data) == num_args(enqueue))
+    up_heap(heap, heap->num_items - 1);
 
+}
+
+/**
+ * Adds several data elements to the min heap at once, appending them all and then either moving each up or, if the
+ * batch is large compared with the heap, rebuilding the heap bottom-up
+ * Moving k elements up costs up to k comparisons per level of the heap while rebuilding costs about two comparisons
+ * per element in the heap, so the cheaper of the two is used
+ *
+ * @param heap Heap that the data elements will be added to
+ * @param data Array of data elements to add to heap
+ * @param num_data Number of data elements
+ */
+void insert_batch(min_heap_t *heap, void **data, int num_data) {
+
+    int first_new = heap->num_items, depth = 0;
+
+    if (heap->num_items + num_data > heap->capacity) {
+        while (heap->num_items + num_data > heap->capacity) {
+            heap->capacity *= 2;
+        }
+        heap->entries = realloc(heap->entries, heap->capacity * sizeof(*heap->entries));
+        assert(heap->entries);
+    }
+    for (int i = 0; i < num_data; i++) {
+        heap->entries[heap->num_items].key = heap->key ? heap->key(data[i]) : 0;
+        heap->entries[heap->num_items].data = data[i];
+        if (heap->indexed) {
+            set_heap_index(data[i], heap->num_items);
+        }
+        heap->num_items++;
+    }
+
+    for (int size = heap->num_items; size > 1; size /= HEAP_ARITY) {
+        depth++;
+    }
+
+    if ((uint64_t) num_data * depth > 2 * (uint64_t) heap->num_items) {
+        // every parent from the last one back to the root is moved down, so each subtree is a heap once it is reached
+        for (int index = (heap->num_items - 2) / HEAP_ARITY; index >= 0 && heap->num_items > 1; index--) {
+            down_heap(heap, index);
+        }
+    } else {
+        for (int index = first_new; index < heap->num_items; index++) {
+            up_heap(heap, index);
+        }
+    }
 
 }
 
@@ -78,81 +173,179 @@ void *extract_min(min_heap_t *heap) {
         return NULL;
     }
     // extracts min
-    void *min = heap->data[0];
+    void *min = heap->entries[0].data;
     heap->num_items--;
+    if (heap->indexed) {
+        set_heap_index(min, NOT_IN_HEAP);
+    }
 
     // empty heap
     if (heap->num_items == 0) {
-        heap->data[0] = NULL;
         return min;
     }
     // move last element to first
-    heap->data[0] = heap->data[heap->num_items];
+    place(heap, 0, heap->entries[heap->num_items]);
 
-    // fix heap (need to use specific comparison function here as num_args(extract_min) == num_args(dequeue))
-    down_heap(heap, 0, (compare_func) compare_process);
+    // fix heap (comparison function is stored in the heap as num_args(extract_min) == num_args(dequeue))
+    down_heap(heap, 0);
 
     return min;
 
+}
+
+/**
+ * Gets the minimum data element without removing it
+ *
+ * @param heap Specified heap
+ * @return Minimum data element or NULL if the heap is empty
+ */
+void *peek_min(min_heap_t *heap) {
 
+    return heap->num_items ? heap->entries[0].data : NULL;
 }
 
 /**
- * Performs up heap operation after data element is inserted
- * This function was adapted from https://www.geeksforgeeks.org/building-heap-from-array/
+ * Moves a process to its correct position after its key has changed (indexed heaps only)
  *
- * @param heap Heap to be fixed
- * @param index Index of inserted item
+ * @param heap Indexed heap containing the process
+ * @param data Process whose key has changed
+ */
+void update_data(min_heap_t *heap, void *data) {
+
+    assert(heap->indexed && get_heap_index(data) != NOT_IN_HEAP);
+    int index = get_heap_index(data);
+
+    heap->entries[index].key = heap->key ? heap->key(data) : 0;
+    fix_heap(heap, index);
+
+}
+
+/**
+ * Removes a process from anywhere in the heap (indexed heaps only)
+ *
+ * @param heap Indexed heap containing the process
+ * @param data Process to be removed
  */
-static void up_heap(min_heap_t *heap, int index, compare_func compare) {
-    int parent = (index - 1) / 2;
-    if (index > 0 && compare(heap->data[parent], heap->data[index]) > 0) {
-        void *temp = heap->data[index];
-        heap->data[index] = heap->data[parent];
-        heap->data[parent] = temp;
-        up_heap(heap, parent, compare);
+void remove_data(min_heap_t *heap, void *data) {
+
+    assert(heap->indexed && get_heap_index(data) != NOT_IN_HEAP);
+    int index = get_heap_index(data);
+
+    heap->num_items--;
+    set_heap_index(data, NOT_IN_HEAP);
+    if (index == heap->num_items) {
+        return;
     }
+
+    // last element takes its place and is moved up or down
+    place(heap, index, heap->entries[heap->num_items]);
+    fix_heap(heap, index);
+
 }
 
 /**
- * Performs down heap operation after min is deleted
- * This function was adapted from https://www.geeksforgeeks.org/building-heap-from-array/
+ * Checks whether an entry comes before another, comparing keys and only comparing the data if they are equal
  *
- * @param heap Heap to be fixed
- * @param index Index of deleted data element (0)
+ * @param heap Specified heap
+ * @param entry1 First entry
+ * @param entry2 Second entry
+ * @return 1 if entry1 comes first, 0 otherwise
  */
- static void down_heap(min_heap_t *heap, int index, compare_func compare) {
+static int precedes(min_heap_t *heap, heap_entry_t *entry1, heap_entry_t *entry2) {
 
-    int smallest = index;
-    int left = 2 * index + 1;
-    int right = 2 * index + 2;
+    if (entry1->key != entry2->key) {
+        return entry1->key < entry2->key;
+    }
+    return heap->compare(entry1->data, entry2->data) < 0;
 
-    if (left < heap->num_items && compare(heap->data[smallest], heap->data[left]) > 0) {
-        smallest = left;
+}
+
+/**
+ * Puts an entry at an index, updating its stored index if the heap is indexed
+ *
+ * @param heap Specified heap
+ * @param index Index to put the entry at
+ * @param entry Entry to be put
+ */
+static void place(min_heap_t *heap, int index, heap_entry_t entry) {
+
+    heap->entries[index] = entry;
+    if (heap->indexed) {
+        set_heap_index(entry.data, index);
     }
 
-    if (right < heap->num_items && compare_process(heap->data[smallest], heap->data[right]) > 0) {
-        smallest = right;
+}
+
+/**
+ * Moves the data element at an index up or down until the heap property holds
+ *
+ * @param heap Heap to be fixed
+ * @param index Index of data element that may be out of place
+ */
+static void fix_heap(min_heap_t *heap, int index) {
+
+    if (index > 0 && precedes(heap, &heap->entries[index], &heap->entries[(index - 1) / HEAP_ARITY])) {
+        up_heap(heap, index);
+    } else {
+        down_heap(heap, index);
     }
 
-    if (smallest != index) {
-        swap(&heap->data[index], &heap->data[smallest]);
-        down_heap(heap, smallest, compare);
+}
+
+/**
+ * Performs up heap operation after data element is inserted
+ * Parents are moved down into the gap rather than swapped, and the element is only written once at the end
+ *
+ * @param heap Heap to be fixed
+ * @param index Index of inserted item
+ */
+static void up_heap(min_heap_t *heap, int index) {
+
+    heap_entry_t entry = heap->entries[index];
+    int parent;
+
+    while (index > 0) {
+        parent = (index - 1) / HEAP_ARITY;
+        if (!precedes(heap, &entry, &heap->entries[parent])) {
+            break;
+        }
+        place(heap, index, heap->entries[parent]);
+        index = parent;
     }
+    place(heap, index, entry);
 
 }
 
 /**
- * Swaps two data elements in the heap
+ * Performs down heap operation after min is deleted
+ * The smallest child is moved up into the gap until the element is no bigger than it
  *
- * @param d1 Data 1
- * @param d2 Data 2
+ * @param heap Heap to be fixed
+ * @param index Index of deleted data element (0)
  */
-static void swap(void **d1, void **d2) {
+static void down_heap(min_heap_t *heap, int index) {
+
+    heap_entry_t entry = heap->entries[index];
+    int first, last, smallest;
+
+    while ((first = HEAP_ARITY * index + 1) < heap->num_items) {
+        last = first + HEAP_ARITY < heap->num_items ? first + HEAP_ARITY : heap->num_items;
+
+        smallest = first;
+        for (int child = first + 1; child < last; child++) {
+            if (precedes(heap, &heap->entries[child], &heap->entries[smallest])) {
+                smallest = child;
+            }
+        }
+
+        if (!precedes(heap, &heap->entries[smallest], &entry)) {
+            break;
+        }
+        place(heap, index, heap->entries[smallest]);
+        index = smallest;
+    }
+    place(heap, index, entry);
 
-    void *temp = *d1;
-    *d1 = *d2;
-    *d2 = temp;
 }
 
 /**
@@ -162,8 +355,8 @@ static void swap(void **d1, void **d2) {
  */
 void free_heap(min_heap_t *heap) {
 
-    free(heap->data);
-    heap->data = NULL;
+    free(heap->entries);
+    heap->entries = NULL;
     free(heap);
     heap = NULL;
 
@@ -7,18 +7,45 @@
 #ifndef MIN_HEAP_H
 #define MIN_HEAP_H
 
+#include <stdint.h>
+
 #define INIT_SIZE 2
+// children per node, so the heap is shallower and the children of a node share cache lines
+#define HEAP_ARITY 4
 
 typedef struct min_heap min_heap_t;
+typedef int (*heap_compare_func)(void *, void *);
+typedef uint64_t (*heap_key_func)(void *);
 
 
 /**
- * This function creates an empty min heap of size 2
+ * This function creates an empty min heap of size 2, ordered by SJF key and then compare_process
  *
  * @return An empty heap
  */
 min_heap_t *create_heap();
 
+/**
+ * Creates an empty min heap ordered by a key and then the given function instead of compare_process
+ * The key of each data element is stored next to it, so most comparisons do not dereference the data
+ *
+ * @param compare Function that orders data elements with equal keys
+ * @param key Function giving the key of a data element, which must order them the same way as compare (NULL if
+ * compare alone orders them)
+ * @return An empty heap
+ */
+min_heap_t *create_ordered_heap(heap_compare_func compare, heap_key_func key);
+
+/**
+ * Creates an empty min heap of processes in which each process stores its index, so that a process can be moved
+ * when its key changes or removed from anywhere in the heap
+ *
+ * @param compare Function that orders processes with equal keys
+ * @param key Function giving the key of a process (NULL if compare alone orders them)
+ * @return An empty indexed heap
+ */
+min_heap_t *create_indexed_heap(heap_compare_func compare, heap_key_func key);
+
 /**
  * This function adds a data element to the min heap and heapifies it
  *
@@ -27,6 +54,16 @@ min_heap_t *create_heap();
  */
 void insert_data(min_heap_t *heap, void *data);
 
+/**
+ * Adds several data elements to the min heap at once, appending them all and then either moving each up or, if the
+ * batch is large compared with the heap, rebuilding the heap bottom-up
+ *
+ * @param heap Heap that the data elements will be added to
+ * @param data Array of data elements to add to heap
+ * @param num_data Number of data elements
+ */
+void insert_batch(min_heap_t *heap, void **data, int num_data);
+
 /**
  * This function extracts minimum data element from heap and then fixes heap
  *
@@ -35,6 +72,30 @@ void insert_data(min_heap_t *heap, void *data);
  */
 void *extract_min(min_heap_t *heap);
 
+/**
+ * Gets the minimum data element without removing it
+ *
+ * @param heap Specified heap
+ * @return Minimum data element or NULL if the heap is empty
+ */
+void *peek_min(min_heap_t *heap);
+
+/**
+ * Moves a process to its correct position after its key has changed (indexed heaps only)
+ *
+ * @param heap Indexed heap containing the process
+ * @param data Process whose key has changed
+ */
+void update_data(min_heap_t *heap, void *data);
+
+/**
+ * Removes a process from anywhere in the heap (indexed heaps only)
+ *
+ * @param heap Indexed heap containing the process
+ * @param data Process to be removed
+ */
+void remove_data(min_heap_t *heap, void *data);
+
 /**
  * Frees the min heap
  *
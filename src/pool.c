@@ -0,0 +1,168 @@
+/*
+ * pool.c - Contains the fixed size object pool used to recycle frequently allocated nodes and blocks
+ * Author: Tristan Thomas
+ * Date: 17-10-2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "pool.h"
+
+/* Definitions of a slab (header followed by SLAB_SIZE objects) and the pool */
+typedef struct slab slab_t;
+
+struct slab {
+    slab_t *next;
+};
+
+struct pool {
+    size_t object_size;
+    // free objects, each storing a pointer to the next free object
+    void *free_objects;
+    slab_t *slabs;
+    int num_live;
+    int peak_live;
+};
+
+// objects are aligned for any type, so the header is padded to a multiple of this
+#define ALIGNMENT _Alignof(max_align_t)
+#define ROUND_UP(size) (((size) + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT)
+
+static void add_slab(pool_t *pool);
+
+
+/**
+ * Creates an empty pool of fixed size objects
+ *
+ * @param object_size Size of each object in Bytes
+ * @return Empty pool
+ */
+pool_t *create_pool(size_t object_size) {
+
+    pool_t *pool = malloc(sizeof(*pool));
+    assert(pool);
+
+    // free objects need to be able to hold the free list pointer
+    if (object_size < sizeof(void *)) {
+        object_size = sizeof(void *);
+    }
+
+    pool->object_size = ROUND_UP(object_size);
+    pool->free_objects = NULL;
+    pool->slabs = NULL;
+    pool->num_live = 0;
+    pool->peak_live = 0;
+
+    return pool;
+
+}
+
+/**
+ * Takes an object from the pool, allocating a new slab of objects if there are no free objects left
+ *
+ * @param pool Pool to allocate from
+ * @return Uninitialised object
+ */
+void *pool_alloc(pool_t *pool) {
+
+    if (!pool->free_objects) {
+        add_slab(pool);
+    }
+
+    // pops the head of the free list
+    void *object = pool->free_objects;
+    pool->free_objects = *(void **) object;
+
+    if (++pool->num_live > pool->peak_live) {
+        pool->peak_live = pool->num_live;
+    }
+
+    return object;
+
+}
+
+/**
+ * Returns an object to the pool so that it can be reused
+ *
+ * @param pool Pool the object was allocated from
+ * @param object Object to be freed
+ */
+void pool_free(pool_t *pool, void *object) {
+
+    if (!object) {
+        return;
+    }
+
+    *(void **) object = pool->free_objects;
+    pool->free_objects = object;
+    pool->num_live--;
+
+}
+
+/**
+ * Allocates a new slab and adds all of its objects to the free list
+ *
+ * @param pool Pool to be extended
+ */
+static void add_slab(pool_t *pool) {
+
+    slab_t *slab = malloc(ROUND_UP(sizeof(*slab)) + SLAB_SIZE * pool->object_size);
+    assert(slab);
+
+    slab->next = pool->slabs;
+    pool->slabs = slab;
+
+    // objects start after the (padded) header and are pushed in reverse so they are handed out in address order
+    char *objects = (char *) slab + ROUND_UP(sizeof(*slab));
+    for (int i = SLAB_SIZE - 1; i >= 0; i--) {
+        void *object = objects + i * pool->object_size;
+        *(void **) object = pool->free_objects;
+        pool->free_objects = object;
+    }
+
+}
+
+/**
+ * Gets the number of objects currently allocated from the pool
+ *
+ * @param pool Specified pool
+ * @return Number of live objects
+ */
+int get_pool_live(pool_t *pool) {
+
+    return pool->num_live;
+}
+
+/**
+ * Gets the largest number of objects that were allocated from the pool at once
+ *
+ * @param pool Specified pool
+ * @return Peak number of live objects
+ */
+int get_pool_peak(pool_t *pool) {
+
+    return pool->peak_live;
+}
+
+/**
+ * Frees the pool and all of its slabs at once (including any objects still allocated)
+ *
+ * @param pool Pool to be freed
+ */
+void free_pool(pool_t *pool) {
+
+    slab_t *curr = pool->slabs;
+    slab_t *next;
+
+    while (curr) {
+        next = curr->next;
+        free(curr);
+        curr = next;
+    }
+
+    free(pool);
+    pool = NULL;
+
+}
@@ -0,0 +1,65 @@
+/*
+ * pool.h - Contains the interface for the fixed size object pool (slab allocator)
+ * Author: Tristan Thomas
+ * Date: 17-10-2026
+ */
+
+#ifndef POOL_H
+#define POOL_H
+
+#include <stddef.h>
+
+// number of objects allocated at once when a pool runs out
+#define SLAB_SIZE 256
+
+typedef struct pool pool_t;
+
+
+/**
+ * Creates an empty pool of fixed size objects
+ *
+ * @param object_size Size of each object in Bytes
+ * @return Empty pool
+ */
+pool_t *create_pool(size_t object_size);
+
+/**
+ * Takes an object from the pool, allocating a new slab of objects if there are no free objects left
+ *
+ * @param pool Pool to allocate from
+ * @return Uninitialised object
+ */
+void *pool_alloc(pool_t *pool);
+
+/**
+ * Returns an object to the pool so that it can be reused
+ *
+ * @param pool Pool the object was allocated from
+ * @param object Object to be freed
+ */
+void pool_free(pool_t *pool, void *object);
+
+/**
+ * Gets the number of objects currently allocated from the pool
+ *
+ * @param pool Specified pool
+ * @return Number of live objects
+ */
+int get_pool_live(pool_t *pool);
+
+/**
+ * Gets the largest number of objects that were allocated from the pool at once
+ *
+ * @param pool Specified pool
+ * @return Peak number of live objects
+ */
+int get_pool_peak(pool_t *pool);
+
+/**
+ * Frees the pool and all of its slabs at once (including any objects still allocated)
+ *
+ * @param pool Pool to be freed
+ */
+void free_pool(pool_t *pool);
+
+#endif
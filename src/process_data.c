@@ -8,24 +8,54 @@
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+#include <ctype.h>
 #include <unistd.h>
+#include <inttypes.h>
 
 #include "process_data.h"
 #include "linked_list.h"
 
+// scanf conversion of a name, bounded so that it cannot overflow the name buffer
+#define NAME_CONVERSION(len) WIDTH_CONVERSION(len)
+#define WIDTH_CONVERSION(len) "%" #len "s"
+
 /* Definition of a process */
 struct process {
     uint32_t arrival_time, service_time, service_time_left, finish_time, turnaround_time;
-    int mem_requirement;
+    // 0 is the highest priority
+    uint32_t priority;
+    // absolute deadline (NO_DEADLINE if there is none)
+    uint64_t deadline;
+    // service time, arrival time and rank of name packed so that SJF ordering is one comparison
+    uint64_t sjf_key;
+    // stride scheduling tickets and pass, and the pass and busy time of its CPU when it joined it, with the pass and
+    // time it has gone through on CPUs (to compare its share of a CPU with its share of the tickets)
+    uint32_t tickets;
+    uint64_t pass, pass_mark, busy_mark, entitled_pass, runnable_time;
+    // niceness and running time weighted by it (CFS)
+    int nice;
+    uint64_t vruntime;
+    uint64_t mem_requirement;
     double overhead;
     char* name;
     state_t state;
     node_t *block_node;
+    page_table_t *page_table;
+    int heap_index;
+    // links the process into the list, input, ready (MLFQ and PRIO) or finished queue it is in (only ever one)
+    node_t queue_node;
     pid_t pid;
     int fd_out[2],fd_in[2];
 };
 
 static process_t *read_process(FILE **file);
+static void pack_sjf_keys(list_t *processes);
+static int compare_names(const void *p1, const void *p2);
+static int bit_width(uint64_t value);
+static int read_column(char **optional, const char *format, void *value);
+
+// whether the SJF keys of the loaded processes hold all of service time, arrival time and rank of name
+static int sjf_keys_packed = 0;
 
 
 /**
@@ -37,44 +67,200 @@ static process_t *read_process(FILE **file);
  */
 list_t *load_processes(list_t *processes, FILE **file) {
 
+    process_t *process;
+
     processes = create_empty_list();
 
     // adds process to linked list until EOF is reached
-    while (enqueue(processes, read_process(file)));
+    while ((process = read_process(file))) {
+        enqueue_node(processes, &process->queue_node);
+    }
+
+    pack_sjf_keys(processes);
 
     return processes;
 }
 
+/**
+ * Ranks the names of the processes once, by sorting them, and packs the service time, arrival time and name rank of
+ * each process into its SJF key if they fit in 64 bits together
+ *
+ * @param processes List of processes
+ */
+static void pack_sjf_keys(list_t *processes) {
+
+    int num_processes = get_list_size(processes), i = 0, rank_bits, arrival_bits;
+    uint32_t max_service_time = 0, max_arrival_time = 0;
+    uint64_t rank = 0;
+    process_t **sorted = malloc((num_processes ? num_processes : 1) * sizeof(*sorted));
+    assert(sorted);
+
+    for (node_t *curr = get_head(processes); curr; curr = get_next(curr)) {
+        sorted[i++] = (process_t *) get_data(curr);
+    }
+    qsort(sorted, num_processes, sizeof(*sorted), compare_names);
+
+    // equal names share a rank, the rank is kept in the key until it is packed
+    for (i = 0; i < num_processes; i++) {
+        if (i > 0 && strcmp(sorted[i - 1]->name, sorted[i]->name) != 0) {
+            rank++;
+        }
+        sorted[i]->sjf_key = rank;
+        if (sorted[i]->service_time > max_service_time) {
+            max_service_time = sorted[i]->service_time;
+        }
+        if (sorted[i]->arrival_time > max_arrival_time) {
+            max_arrival_time = sorted[i]->arrival_time;
+        }
+    }
+
+    rank_bits = bit_width(rank);
+    arrival_bits = bit_width(max_arrival_time);
+    sjf_keys_packed = bit_width(max_service_time) + arrival_bits + rank_bits <= 64;
+
+    for (i = 0; i < num_processes; i++) {
+        if (sjf_keys_packed) {
+            sorted[i]->sjf_key |= ((uint64_t) sorted[i]->service_time << arrival_bits |
+                                   sorted[i]->arrival_time) << rank_bits;
+        } else {
+            // compare_process breaks ties between equal service times
+            sorted[i]->sjf_key = sorted[i]->service_time;
+        }
+    }
+
+    free(sorted);
+
+}
+
+/**
+ * Compares the names of two processes, used for sorting them
+ *
+ * @param p1 Pointer to process 1
+ * @param p2 Pointer to process 2
+ * @return Lexicographical order of names
+ */
+static int compare_names(const void *p1, const void *p2) {
+
+    return strcmp((*(process_t **) p1)->name, (*(process_t **) p2)->name);
+}
+
+/**
+ * Gets the number of bits needed to store a value
+ *
+ * @param value Specified value
+ * @return Position of highest set bit plus one (0 for 0)
+ */
+static int bit_width(uint64_t value) {
+
+    return value ? 64 - __builtin_clzll(value) : 0;
+}
+
 /**
  * Reads a single process from a file
+ * Each line has the arrival time, name, service time and memory requirement, optionally followed by the priority
+ * and then the deadline relative to arrival, the tickets and the niceness (optional columns are positional, so a
+ * priority, deadline or number of tickets that is not wanted is given as a placeholder that keeps its default)
  *
  * @param file File to be read from
- * @return New process
+ * @return New process or NULL at the end of the file
  */
 static process_t *read_process(FILE **file) {
 
-    char name[MAX_NAME_LEN] = "";
-    uint32_t service_time = 0, time_arrived = 0;
-    int mem_requirement = 0;
+    char line[MAX_LINE_LEN], name[MAX_NAME_LEN + 1] = "";
+    uint32_t service_time = 0, time_arrived = 0, priority = DEFAULT_PRIORITY, relative_deadline;
+    uint32_t tickets = DEFAULT_TICKETS;
+    int nice = DEFAULT_NICE;
+    uint64_t mem_requirement = 0, deadline = NO_DEADLINE;
     process_t *process = NULL;
+    char *optional;
+    int num_read = 0, name_end, found;
+
+    // lines without all of the required columns (such as blank lines) are skipped
+    do {
+        if (!fgets(line, sizeof(line), *file)) {
+            return NULL;
+        }
+        name_end = 0;
+        found = sscanf(line, "%u " NAME_CONVERSION(MAX_NAME_LEN) "%n %u %" SCNu64 "%n", &time_arrived, name,
+                       &name_end, &service_time, &mem_requirement, &num_read);
+
+        // the rest of a longer name would otherwise be read as the following columns
+        if (found >= 2 && line[name_end] != '\0' && !isspace((unsigned char) line[name_end])) {
+            fprintf(stderr, "Process name longer than %d characters: %s", MAX_NAME_LEN, line);
+            exit(EXIT_FAILURE);
+        }
+    } while (found < 4);
+
+    optional = line + num_read;
+    if ((found = read_column(&optional, "%u%n", &priority)) > 0) {
+        assert(priority <= MAX_PRIORITY);
+    }
+    if (found >= 0 && (found = read_column(&optional, "%u%n", &relative_deadline)) > 0) {
+        deadline = (uint64_t) time_arrived + relative_deadline;
+    }
+    if (found >= 0 && (found = read_column(&optional, "%u%n", &tickets)) > 0) {
+        assert(tickets > 0 && tickets <= STRIDE1);
+    }
+    if (found >= 0 && sscanf(optional, "%d", &nice) == 1) {
+        assert(nice >= MIN_NICE && nice <= MAX_NICE);
+    }
+
+    process = malloc(sizeof(*process));
+    assert(process);
+
+    process->state = IDLE;
+    process->mem_requirement = mem_requirement;
+    process->service_time = service_time;
+    process->service_time_left = service_time;
+    process->arrival_time = time_arrived;
+    process->priority = priority;
+    process->deadline = deadline;
+    process->tickets = tickets;
+    process->pass = 0;
+    process->pass_mark = 0;
+    process->busy_mark = 0;
+    process->entitled_pass = 0;
+    process->runnable_time = 0;
+    process->nice = nice;
+    process->vruntime = 0;
+    process->name = strdup(name);
+    process->block_node = NULL;
+    process->page_table = NULL;
+    process->heap_index = NOT_IN_HEAP;
+    init_node(&process->queue_node, process);
+    process->pid = 0;
+    process->fd_in[READ] = process->fd_in[WRITE] = NO_FD;
+    process->fd_out[READ] = process->fd_out[WRITE] = NO_FD;
 
-    if (fscanf(*file, "%u %s %u %d", &time_arrived, name, &service_time, &mem_requirement) != EOF) {
+    return process;
+
+}
+
+/**
+ * Reads the next optional column of a line, which may be a placeholder that leaves the value at its default
+ *
+ * @param optional Position in the line, moved past the column if there is one
+ * @param format Format of the value followed by %n
+ * @param value Where the value is stored
+ * @return 1 if a value was read, 0 for a placeholder and -1 if there are no more columns
+ */
+static int read_column(char **optional, const char *format, void *value) {
 
-        process = malloc(sizeof(*process));
-        assert(process);
+    int num_read = 0;
 
-        process->state = IDLE;
-        process->mem_requirement = mem_requirement;
-        process->service_time = service_time;
-        process->service_time_left = service_time;
-        process->arrival_time = time_arrived;
-        process->name = strdup(name);
-        process->block_node = NULL;
-        process->pid = 0;
+    if (sscanf(*optional, format, value, &num_read) == 1) {
+        *optional += num_read;
+        return 1;
+    }
 
+    // the placeholder must be a column of its own
+    *optional += strspn(*optional, " \t");
+    if (**optional == PLACEHOLDER && (isspace((unsigned char) (*optional)[1]) || (*optional)[1] == '\0')) {
+        (*optional)++;
+        return 0;
     }
 
-    return process;
+    return -1;
 
 }
 
@@ -87,8 +273,13 @@ void free_process(process_t *process) {
 
     free(process->name);
     process->name = NULL;
-    close(process->fd_in[READ]);
-    close(process->fd_out[WRITE]);
+    // processes that never started have no pipes to close
+    if (process->fd_in[READ] != NO_FD) {
+        close(process->fd_in[READ]);
+    }
+    if (process->fd_out[WRITE] != NO_FD) {
+        close(process->fd_out[WRITE]);
+    }
     free(process);
     process = NULL;
 
@@ -120,6 +311,19 @@ double get_value(process_t *process, enum value field) {
             return process->overhead;
         case PID:
             return process->pid;
+        case PRIORITY:
+            return process->priority;
+        case TICKETS:
+            return process->tickets;
+        case ACHIEVED_SHARE:
+            // CPU time it got out of the time it was waiting for or running on a CPU
+            return process->runnable_time ? (double) process->service_time / process->runnable_time : 0;
+        case NICE:
+            return process->nice;
+        case TARGET_SHARE:
+            // CPU time its tickets entitled it to out of the same time
+            return process->runnable_time ? (double) process->tickets * process->entitled_pass / STRIDE1 /
+                                            process->runnable_time : 0;
         default:
             exit(EXIT_FAILURE);
     }
@@ -160,6 +364,114 @@ int update_time(int quantum, process_t *process) {
 
 }
 
+/**
+ * Gets the memory requirement of a process (separate from get_value as it may not fit in a double)
+ *
+ * @param process Specified process
+ * @return Memory requirement in Bytes
+ */
+uint64_t get_mem_requirement(process_t *process) {
+
+    return process->mem_requirement;
+}
+
+/**
+ * Gets the SJF key of a process, which orders processes the same way as compare_process
+ *
+ * @param process Specified process
+ * @return Service time, arrival time and rank of name packed into one integer, or only the service time if they did
+ * not fit in 64 bits
+ */
+uint64_t get_sjf_key(process_t *process) {
+
+    return process->sjf_key;
+}
+
+/**
+ * Gets the absolute deadline of a process (separate from get_value as it may not fit in a double)
+ *
+ * @param process Specified process
+ * @return Arrival time plus relative deadline or NO_DEADLINE if the process has none
+ */
+uint64_t get_deadline(process_t *process) {
+
+    return process->deadline;
+}
+
+/**
+ * Gets the stride scheduling pass of a process
+ *
+ * @param process Specified process
+ * @return Pass
+ */
+uint64_t get_pass(process_t *process) {
+
+    return process->pass;
+}
+
+/**
+ * Sets the stride scheduling pass of a process
+ *
+ * @param process Process to be updated
+ * @param pass New pass
+ */
+void set_pass(process_t *process, uint64_t pass) {
+
+    process->pass = pass;
+}
+
+/**
+ * Gets the virtual runtime of a process (CFS)
+ *
+ * @param process Specified process
+ * @return Virtual runtime
+ */
+uint64_t get_vruntime(process_t *process) {
+
+    return process->vruntime;
+}
+
+/**
+ * Sets the virtual runtime of a process (CFS)
+ *
+ * @param process Process to be updated
+ * @param vruntime New virtual runtime
+ */
+void set_vruntime(process_t *process, uint64_t vruntime) {
+
+    process->vruntime = vruntime;
+}
+
+/**
+ * Starts accounting the share of a CPU a process gets, from when it joins the ready queue of a CPU
+ *
+ * @param process Process joining a CPU
+ * @param global_pass Pass of the CPU, which goes up by STRIDE1 times the cycle length over the tickets on the CPU
+ * @param busy_time Time the CPU has spent running processes
+ */
+void join_share(process_t *process, uint64_t global_pass, uint64_t busy_time) {
+
+    process->pass_mark = global_pass;
+    process->busy_mark = busy_time;
+
+}
+
+/**
+ * Adds the CPU time a process was entitled to while on a CPU, and the time it could have run for, when it leaves the
+ * CPU (these give TARGET_SHARE and ACHIEVED_SHARE)
+ *
+ * @param process Process leaving a CPU
+ * @param global_pass Pass of the CPU
+ * @param busy_time Time the CPU has spent running processes
+ */
+void leave_share(process_t *process, uint64_t global_pass, uint64_t busy_time) {
+
+    // the CPU is busy the whole time a process is waiting for it or running on it
+    process->entitled_pass += global_pass - process->pass_mark;
+    process->runnable_time += busy_time - process->busy_mark;
+
+}
+
 /**
  * Gets process name
  *
@@ -202,6 +514,15 @@ void set_value(process_t *process, uint32_t value, enum value field) {
         case PID:
             process->pid = value;
             break;
+        case PRIORITY:
+            process->priority = value;
+            break;
+        case TICKETS:
+            process->tickets = value;
+            break;
+        case NICE:
+            process->nice = (int32_t) value;
+            break;
         default:
             exit(EXIT_FAILURE);
 
@@ -218,6 +539,10 @@ void set_value(process_t *process, uint32_t value, enum value field) {
  */
 int compare_process(process_t *p1, process_t *p2) {
 
+    if (sjf_keys_packed) {
+        return (p1->sjf_key > p2->sjf_key) - (p1->sjf_key < p2->sjf_key);
+    }
+
     if (p1->service_time < p2->service_time) {
         return -1;
     } else if (p1->service_time > p2->service_time) {
@@ -232,6 +557,101 @@ int compare_process(process_t *p1, process_t *p2) {
     }
 }
 
+/**
+ * Compares two processes based on service time left, arrival time and then lexicographial ordering, used for
+ * shortest remaining time first
+ *
+ * @param p1 Process 1
+ * @param p2 Process 2
+ * @return An int based on comparison property
+ */
+int compare_remaining(process_t *p1, process_t *p2) {
+
+    if (p1->service_time_left < p2->service_time_left) {
+        return -1;
+    } else if (p1->service_time_left > p2->service_time_left) {
+        return 1;
+    } else if (p1->arrival_time < p2->arrival_time) {
+        return -1;
+    } else if (p1->arrival_time > p2->arrival_time) {
+        return 1;
+    } else {
+        // lexicographical order of name
+        return strcmp(p1->name, p2->name);
+    }
+}
+
+/**
+ * Compares two processes based on absolute deadline, arrival time and then lexicographial ordering, used for
+ * earliest deadline first
+ *
+ * @param p1 Process 1
+ * @param p2 Process 2
+ * @return An int based on comparison property
+ */
+int compare_deadline(process_t *p1, process_t *p2) {
+
+    if (p1->deadline < p2->deadline) {
+        return -1;
+    } else if (p1->deadline > p2->deadline) {
+        return 1;
+    } else if (p1->arrival_time < p2->arrival_time) {
+        return -1;
+    } else if (p1->arrival_time > p2->arrival_time) {
+        return 1;
+    } else {
+        // lexicographical order of name
+        return strcmp(p1->name, p2->name);
+    }
+}
+
+/**
+ * Compares two processes based on stride scheduling pass, arrival time and then lexicographial ordering, used for
+ * stride scheduling
+ *
+ * @param p1 Process 1
+ * @param p2 Process 2
+ * @return An int based on comparison property
+ */
+int compare_pass(process_t *p1, process_t *p2) {
+
+    if (p1->pass < p2->pass) {
+        return -1;
+    } else if (p1->pass > p2->pass) {
+        return 1;
+    } else if (p1->arrival_time < p2->arrival_time) {
+        return -1;
+    } else if (p1->arrival_time > p2->arrival_time) {
+        return 1;
+    } else {
+        // lexicographical order of name
+        return strcmp(p1->name, p2->name);
+    }
+}
+
+/**
+ * Compares two processes based on virtual runtime, arrival time and then lexicographial ordering, used for CFS
+ *
+ * @param p1 Process 1
+ * @param p2 Process 2
+ * @return An int based on comparison property
+ */
+int compare_vruntime(process_t *p1, process_t *p2) {
+
+    if (p1->vruntime < p2->vruntime) {
+        return -1;
+    } else if (p1->vruntime > p2->vruntime) {
+        return 1;
+    } else if (p1->arrival_time < p2->arrival_time) {
+        return -1;
+    } else if (p1->arrival_time > p2->arrival_time) {
+        return 1;
+    } else {
+        // lexicographical order of name
+        return strcmp(p1->name, p2->name);
+    }
+}
+
 /**
  * Sets state of process
  *
@@ -243,6 +663,17 @@ void set_state(process_t *process, state_t state) {
     process->state = state;
 }
 
+/**
+ * Gets state of process
+ *
+ * @param process Specified process
+ * @return State of process
+ */
+state_t get_state(process_t *process) {
+
+    return process->state;
+}
+
 /**
  * Sets the memory block of a process (as a node of memory list)
  *
@@ -254,6 +685,17 @@ void set_block_node(process_t *process, node_t *block_node) {
     process->block_node = block_node;
 }
 
+/**
+ * Gets the node embedded in a process that links it into the queue it is in
+ *
+ * @param process Specified process
+ * @return Queue node
+ */
+node_t *get_queue_node(process_t *process) {
+
+    return &process->queue_node;
+}
+
 /**
  * Gets the block node from a process
  *
@@ -265,6 +707,50 @@ node_t *get_block_node(process_t *process) {
     return process->block_node;
 }
 
+/**
+ * Sets the page table of a process (paged memory only)
+ *
+ * @param process Process to be updated
+ * @param page_table Page table from memory
+ */
+void set_page_table(process_t *process, page_table_t *page_table) {
+
+    process->page_table = page_table;
+}
+
+/**
+ * Gets the page table from a process
+ *
+ * @param process Specified process
+ * @return Page table or NULL if process is not paged
+ */
+page_table_t *get_page_table(process_t *process) {
+
+    return process->page_table;
+}
+
+/**
+ * Sets the index of a process in an indexed heap
+ *
+ * @param process Process to be updated
+ * @param heap_index Index in heap (NOT_IN_HEAP if it has been removed)
+ */
+void set_heap_index(process_t *process, int heap_index) {
+
+    process->heap_index = heap_index;
+}
+
+/**
+ * Gets the index of a process in an indexed heap
+ *
+ * @param process Specified process
+ * @return Index in heap or NOT_IN_HEAP if it is not in one
+ */
+int get_heap_index(process_t *process) {
+
+    return process->heap_index;
+}
+
 /**
  * Sets the file descriptor pipe pairs of a process
  *
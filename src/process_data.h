@@ -11,8 +11,26 @@
 #include <stdint.h>
 
 #define MAX_NAME_LEN 8
+#define MAX_LINE_LEN 256
+// optional columns after the memory requirement, used when they are not given or given as PLACEHOLDER
+#define PLACEHOLDER '-'
+#define DEFAULT_PRIORITY 0
+#define MAX_PRIORITY 63
+// absolute deadline of a process without one (it is scheduled after all processes with deadlines)
+#define NO_DEADLINE UINT64_MAX
+// stride scheduling, where the stride of a process is STRIDE1 divided by its tickets
+#define DEFAULT_TICKETS 100
+#define STRIDE1 (1 << 20)
+// niceness for CFS, from -20 (most CPU time) to 19
+#define DEFAULT_NICE 0
+#define MIN_NICE -20
+#define MAX_NICE 19
 #define READ 0
 #define WRITE 1
+// file descriptor of a process whose real process has not been started
+#define NO_FD -1
+// heap index of a process that is not in an indexed heap
+#define NOT_IN_HEAP -1
 
 
 typedef enum state state_t;
@@ -20,13 +38,15 @@ typedef struct process process_t;
 typedef struct node node_t;
 typedef struct list list_t;
 typedef struct block block_t;
+typedef struct page_table page_table_t;
 
 enum state {
     IDLE, READY, RUNNING, FINISHED
 };
 
 enum value {
-    ARRIVAL_TIME, SERVICE_TIME, SERVICE_TIME_LEFT, MEMORY_REQUIREMENT, FINISH_TIME, TURNAROUND_TIME, OVERHEAD, PID
+    ARRIVAL_TIME, SERVICE_TIME, SERVICE_TIME_LEFT, MEMORY_REQUIREMENT, FINISH_TIME, TURNAROUND_TIME, OVERHEAD, PID,
+    PRIORITY, TICKETS, ACHIEVED_SHARE, TARGET_SHARE, NICE
 };
 
 /**
@@ -56,6 +76,7 @@ double get_value(process_t *process, enum value field);
 
 /**
  * Compares two processes based on service time, arrival time and then lexicographial ordering, used for min heap sorting
+ * This is a single comparison of SJF keys when they could be packed
  *
  * @param p1 Process 1
  * @param p2 Process 2
@@ -63,6 +84,54 @@ double get_value(process_t *process, enum value field);
  */
 int compare_process(process_t *p1, process_t *p2);
 
+/**
+ * Gets the SJF key of a process, which orders processes the same way as compare_process
+ *
+ * @param process Specified process
+ * @return Service time, arrival time and rank of name packed into one integer, or only the service time if they did
+ * not fit in 64 bits
+ */
+uint64_t get_sjf_key(process_t *process);
+
+/**
+ * Compares two processes based on service time left, arrival time and then lexicographial ordering, used for
+ * shortest remaining time first
+ *
+ * @param p1 Process 1
+ * @param p2 Process 2
+ * @return An int based on comparison property
+ */
+int compare_remaining(process_t *p1, process_t *p2);
+
+/**
+ * Compares two processes based on absolute deadline, arrival time and then lexicographial ordering, used for
+ * earliest deadline first
+ *
+ * @param p1 Process 1
+ * @param p2 Process 2
+ * @return An int based on comparison property
+ */
+int compare_deadline(process_t *p1, process_t *p2);
+
+/**
+ * Compares two processes based on stride scheduling pass, arrival time and then lexicographial ordering, used for
+ * stride scheduling
+ *
+ * @param p1 Process 1
+ * @param p2 Process 2
+ * @return An int based on comparison property
+ */
+int compare_pass(process_t *p1, process_t *p2);
+
+/**
+ * Compares two processes based on virtual runtime, arrival time and then lexicographial ordering, used for CFS
+ *
+ * @param p1 Process 1
+ * @param p2 Process 2
+ * @return An int based on comparison property
+ */
+int compare_vruntime(process_t *p1, process_t *p2);
+
 /**
  * Sets state of process
  *
@@ -71,6 +140,14 @@ int compare_process(process_t *p1, process_t *p2);
  */
 void set_state(process_t *process, state_t state);
 
+/**
+ * Gets state of process
+ *
+ * @param process Specified process
+ * @return State of process
+ */
+state_t get_state(process_t *process);
+
 /**
  * Sets a value of a process
  *
@@ -80,6 +157,73 @@ void set_state(process_t *process, state_t state);
  */
 void set_value(process_t *process, uint32_t value, enum value field);
 
+/**
+ * Gets the memory requirement of a process (separate from get_value as it may not fit in a double)
+ *
+ * @param process Specified process
+ * @return Memory requirement in Bytes
+ */
+uint64_t get_mem_requirement(process_t *process);
+
+/**
+ * Gets the absolute deadline of a process (separate from get_value as it may not fit in a double)
+ *
+ * @param process Specified process
+ * @return Arrival time plus relative deadline or NO_DEADLINE if the process has none
+ */
+uint64_t get_deadline(process_t *process);
+
+/**
+ * Gets the stride scheduling pass of a process
+ *
+ * @param process Specified process
+ * @return Pass
+ */
+uint64_t get_pass(process_t *process);
+
+/**
+ * Sets the stride scheduling pass of a process
+ *
+ * @param process Process to be updated
+ * @param pass New pass
+ */
+void set_pass(process_t *process, uint64_t pass);
+
+/**
+ * Gets the virtual runtime of a process (CFS)
+ *
+ * @param process Specified process
+ * @return Virtual runtime
+ */
+uint64_t get_vruntime(process_t *process);
+
+/**
+ * Sets the virtual runtime of a process (CFS)
+ *
+ * @param process Process to be updated
+ * @param vruntime New virtual runtime
+ */
+void set_vruntime(process_t *process, uint64_t vruntime);
+
+/**
+ * Starts accounting the share of a CPU a process gets, from when it joins the ready queue of a CPU
+ *
+ * @param process Process joining a CPU
+ * @param global_pass Pass of the CPU, which goes up by STRIDE1 times the cycle length over the tickets on the CPU
+ * @param busy_time Time the CPU has spent running processes
+ */
+void join_share(process_t *process, uint64_t global_pass, uint64_t busy_time);
+
+/**
+ * Adds the CPU time a process was entitled to while on a CPU, and the time it could have run for, when it leaves the
+ * CPU (these give TARGET_SHARE and ACHIEVED_SHARE)
+ *
+ * @param process Process leaving a CPU
+ * @param global_pass Pass of the CPU
+ * @param busy_time Time the CPU has spent running processes
+ */
+void leave_share(process_t *process, uint64_t global_pass, uint64_t busy_time);
+
 /**
  * Gets process name
  *
@@ -96,6 +240,15 @@ char *get_name(process_t *process);
  */
 void set_block_node(process_t *process, node_t *block_node);
 
+/**
+ * Gets the node embedded in a process that links it into the queue it is in (moving a process between queues never
+ * allocates, so a process is only ever in one of them)
+ *
+ * @param process Specified process
+ * @return Queue node
+ */
+node_t *get_queue_node(process_t *process);
+
 /**
  * Gets the block node from a process
  *
@@ -104,6 +257,38 @@ void set_block_node(process_t *process, node_t *block_node);
  */
 node_t *get_block_node(process_t *process);
 
+/**
+ * Sets the page table of a process (paged memory only)
+ *
+ * @param process Process to be updated
+ * @param page_table Page table from memory
+ */
+void set_page_table(process_t *process, page_table_t *page_table);
+
+/**
+ * Gets the page table from a process
+ *
+ * @param process Specified process
+ * @return Page table or NULL if process is not paged
+ */
+page_table_t *get_page_table(process_t *process);
+
+/**
+ * Sets the index of a process in an indexed heap
+ *
+ * @param process Process to be updated
+ * @param heap_index Index in heap (NOT_IN_HEAP if it has been removed)
+ */
+void set_heap_index(process_t *process, int heap_index);
+
+/**
+ * Gets the index of a process in an indexed heap
+ *
+ * @param process Specified process
+ * @return Index in heap or NOT_IN_HEAP if it is not in one
+ */
+int get_heap_index(process_t *process);
+
 /**
  * Updates turnaround time and overhead of a process
  *
@@ -0,0 +1,479 @@
+/*
+ * rb_tree.c - Contains the red-black tree data structure and functions
+ * Author: Tristan Thomas
+ * Date: 17-10-2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "rb_tree.h"
+#include "pool.h"
+
+/* Definitions of red-black tree node and main tree (leaves all point to a per tree sentinel) */
+enum colour {
+    RED, BLACK
+};
+
+struct rb_node {
+    void *data;
+    enum colour colour;
+    rb_node_t *left;
+    rb_node_t *right;
+    rb_node_t *parent;
+};
+
+struct rb_tree {
+    rb_node_t *root;
+    rb_node_t nil;
+    tree_compare_func compare;
+    int num_items;
+    // nodes are recycled through a pool that is freed with the tree
+    pool_t *node_pool;
+};
+
+static void rotate_left(rb_tree_t *tree, rb_node_t *node);
+static void rotate_right(rb_tree_t *tree, rb_node_t *node);
+static void insert_fixup(rb_tree_t *tree, rb_node_t *node);
+static void delete_fixup(rb_tree_t *tree, rb_node_t *node);
+static void transplant(rb_tree_t *tree, rb_node_t *old, rb_node_t *new);
+static rb_node_t *subtree_min(rb_tree_t *tree, rb_node_t *node);
+static void free_subtree(rb_tree_t *tree, rb_node_t *node, tree_free_func free_data);
+
+
+/**
+ * Creates an empty red-black tree ordered by a comparison function
+ *
+ * @param compare Function returning <0, 0 or >0 when comparing two data elements
+ * @return Empty tree
+ */
+rb_tree_t *create_tree(tree_compare_func compare) {
+
+    rb_tree_t *tree = malloc(sizeof(*tree));
+    assert(tree);
+
+    tree->nil.data = NULL;
+    tree->nil.colour = BLACK;
+    tree->nil.left = tree->nil.right = tree->nil.parent = &tree->nil;
+    tree->root = &tree->nil;
+    tree->compare = compare;
+    tree->num_items = 0;
+    tree->node_pool = create_pool(sizeof(rb_node_t));
+
+    return tree;
+
+}
+
+/**
+ * Inserts a data element into the tree
+ *
+ * @param tree Tree to be inserted into
+ * @param data Data element
+ * @return Tree node holding the data (handle for later deletion)
+ */
+rb_node_t *tree_insert(rb_tree_t *tree, void *data) {
+
+    rb_node_t *parent = &tree->nil;
+    rb_node_t *curr = tree->root;
+
+    // finds leaf position for new node
+    while (curr != &tree->nil) {
+        parent = curr;
+        curr = (tree->compare(data, curr->data) < 0) ? curr->left : curr->right;
+    }
+
+    rb_node_t *new = pool_alloc(tree->node_pool);
+    new->data = data;
+    new->colour = RED;
+    new->left = new->right = &tree->nil;
+    new->parent = parent;
+
+    if (parent == &tree->nil) {
+        tree->root = new;
+    } else if (tree->compare(data, parent->data) < 0) {
+        parent->left = new;
+    } else {
+        parent->right = new;
+    }
+
+    insert_fixup(tree, new);
+    tree->num_items++;
+
+    return new;
+
+}
+
+/**
+ * Deletes a node from the tree and frees it (data is not freed)
+ *
+ * @param tree Tree to be deleted from
+ * @param node Node to be deleted
+ */
+void tree_delete(rb_tree_t *tree, rb_node_t *node) {
+
+    rb_node_t *removed = node;
+    rb_node_t *child;
+    enum colour removed_colour = removed->colour;
+
+    if (node->left == &tree->nil) {
+        child = node->right;
+        transplant(tree, node, node->right);
+    } else if (node->right == &tree->nil) {
+        child = node->left;
+        transplant(tree, node, node->left);
+    } else {
+        // replace with in-order successor
+        removed = subtree_min(tree, node->right);
+        removed_colour = removed->colour;
+        child = removed->right;
+
+        if (removed->parent == node) {
+            child->parent = removed;
+        } else {
+            transplant(tree, removed, removed->right);
+            removed->right = node->right;
+            removed->right->parent = removed;
+        }
+
+        transplant(tree, node, removed);
+        removed->left = node->left;
+        removed->left->parent = removed;
+        removed->colour = node->colour;
+    }
+
+    if (removed_colour == BLACK) {
+        delete_fixup(tree, child);
+    }
+
+    pool_free(tree->node_pool, node);
+    node = NULL;
+    tree->num_items--;
+
+}
+
+/**
+ * Finds the leftmost node whose data is not less than a key
+ *
+ * @param tree Tree to be searched
+ * @param key Key to compare against
+ * @param compare_key Function comparing a data element (first argument) with the key (second argument)
+ * @return Leftmost node with compare_key(data, key) >= 0 or NULL if there is none
+ */
+rb_node_t *tree_lower_bound(rb_tree_t *tree, void *key, tree_compare_func compare_key) {
+
+    rb_node_t *curr = tree->root;
+    rb_node_t *bound = NULL;
+
+    while (curr != &tree->nil) {
+        if (compare_key(curr->data, key) >= 0) {
+            // candidate found, keep looking for a smaller one
+            bound = curr;
+            curr = curr->left;
+        } else {
+            curr = curr->right;
+        }
+    }
+
+    return bound;
+
+}
+
+/**
+ * Gets the node with the smallest data element
+ *
+ * @param tree Specified tree
+ * @return Minimum node or NULL if tree is empty
+ */
+rb_node_t *tree_min(rb_tree_t *tree) {
+
+    if (tree->root == &tree->nil) {
+        return NULL;
+    }
+
+    return subtree_min(tree, tree->root);
+}
+
+/**
+ * Gets the node with the largest data element
+ *
+ * @param tree Specified tree
+ * @return Maximum node or NULL if tree is empty
+ */
+rb_node_t *tree_max(rb_tree_t *tree) {
+
+    rb_node_t *curr = tree->root;
+
+    if (curr == &tree->nil) {
+        return NULL;
+    }
+
+    while (curr->right != &tree->nil) {
+        curr = curr->right;
+    }
+
+    return curr;
+}
+
+/**
+ * Gets the data of a tree node
+ *
+ * @param node Specified node
+ * @return Data of node
+ */
+void *get_tree_data(rb_node_t *node) {
+
+    return node->data;
+}
+
+/**
+ * Gets the number of items in the tree
+ *
+ * @param tree Specified tree
+ * @return Number of items
+ */
+int get_tree_size(rb_tree_t *tree) {
+
+    return tree->num_items;
+}
+
+/**
+ * Frees a tree and its data
+ *
+ * @param tree Tree to be freed
+ * @param free_data Function for freeing data
+ */
+void free_tree(rb_tree_t *tree, tree_free_func free_data) {
+
+    free_subtree(tree, tree->root, free_data);
+    free_pool(tree->node_pool);
+    free(tree);
+    tree = NULL;
+
+}
+
+/**
+ * Frees the data of all nodes below (and including) a node (nodes themselves are freed with the pool)
+ *
+ * @param tree Tree containing the subtree
+ * @param node Root of subtree
+ * @param free_data Function for freeing data
+ */
+static void free_subtree(rb_tree_t *tree, rb_node_t *node, tree_free_func free_data) {
+
+    if (node == &tree->nil) {
+        return;
+    }
+
+    free_subtree(tree, node->left, free_data);
+    free_subtree(tree, node->right, free_data);
+    free_data(node->data);
+
+}
+
+/**
+ * Gets the leftmost node of a subtree
+ *
+ * @param tree Tree containing the subtree
+ * @param node Root of subtree
+ * @return Minimum node of subtree
+ */
+static rb_node_t *subtree_min(rb_tree_t *tree, rb_node_t *node) {
+
+    while (node->left != &tree->nil) {
+        node = node->left;
+    }
+
+    return node;
+}
+
+/**
+ * Replaces the subtree rooted at one node with the subtree rooted at another
+ *
+ * @param tree Specified tree
+ * @param old Node to be replaced
+ * @param new Replacement node
+ */
+static void transplant(rb_tree_t *tree, rb_node_t *old, rb_node_t *new) {
+
+    if (old->parent == &tree->nil) {
+        tree->root = new;
+    } else if (old == old->parent->left) {
+        old->parent->left = new;
+    } else {
+        old->parent->right = new;
+    }
+
+    new->parent = old->parent;
+
+}
+
+/**
+ * Performs a left rotation around a node
+ * The rotation and fixup functions were adapted from Introduction to Algorithms (CLRS) chapter 13
+ *
+ * @param tree Specified tree
+ * @param node Node to rotate around
+ */
+static void rotate_left(rb_tree_t *tree, rb_node_t *node) {
+
+    rb_node_t *child = node->right;
+
+    node->right = child->left;
+    if (child->left != &tree->nil) {
+        child->left->parent = node;
+    }
+
+    transplant(tree, node, child);
+    child->left = node;
+    node->parent = child;
+
+}
+
+/**
+ * Performs a right rotation around a node
+ *
+ * @param tree Specified tree
+ * @param node Node to rotate around
+ */
+static void rotate_right(rb_tree_t *tree, rb_node_t *node) {
+
+    rb_node_t *child = node->left;
+
+    node->left = child->right;
+    if (child->right != &tree->nil) {
+        child->right->parent = node;
+    }
+
+    transplant(tree, node, child);
+    child->right = node;
+    node->parent = child;
+
+}
+
+/**
+ * Restores red-black properties after an insertion
+ *
+ * @param tree Specified tree
+ * @param node Newly inserted node
+ */
+static void insert_fixup(rb_tree_t *tree, rb_node_t *node) {
+
+    rb_node_t *uncle;
+
+    while (node->parent->colour == RED) {
+        rb_node_t *parent = node->parent;
+        rb_node_t *grandparent = parent->parent;
+
+        if (parent == grandparent->left) {
+            uncle = grandparent->right;
+
+            if (uncle->colour == RED) {
+                // recolour and move up
+                parent->colour = uncle->colour = BLACK;
+                grandparent->colour = RED;
+                node = grandparent;
+            } else {
+                if (node == parent->right) {
+                    node = parent;
+                    rotate_left(tree, node);
+                }
+                node->parent->colour = BLACK;
+                node->parent->parent->colour = RED;
+                rotate_right(tree, node->parent->parent);
+            }
+
+        } else {
+            uncle = grandparent->left;
+
+            if (uncle->colour == RED) {
+                parent->colour = uncle->colour = BLACK;
+                grandparent->colour = RED;
+                node = grandparent;
+            } else {
+                if (node == parent->left) {
+                    node = parent;
+                    rotate_right(tree, node);
+                }
+                node->parent->colour = BLACK;
+                node->parent->parent->colour = RED;
+                rotate_left(tree, node->parent->parent);
+            }
+        }
+    }
+
+    tree->root->colour = BLACK;
+
+}
+
+/**
+ * Restores red-black properties after a deletion
+ *
+ * @param tree Specified tree
+ * @param node Node that replaced the removed node
+ */
+static void delete_fixup(rb_tree_t *tree, rb_node_t *node) {
+
+    rb_node_t *sibling;
+
+    while (node != tree->root && node->colour == BLACK) {
+
+        if (node == node->parent->left) {
+            sibling = node->parent->right;
+
+            if (sibling->colour == RED) {
+                sibling->colour = BLACK;
+                node->parent->colour = RED;
+                rotate_left(tree, node->parent);
+                sibling = node->parent->right;
+            }
+
+            if (sibling->left->colour == BLACK && sibling->right->colour == BLACK) {
+                sibling->colour = RED;
+                node = node->parent;
+            } else {
+                if (sibling->right->colour == BLACK) {
+                    sibling->left->colour = BLACK;
+                    sibling->colour = RED;
+                    rotate_right(tree, sibling);
+                    sibling = node->parent->right;
+                }
+                sibling->colour = node->parent->colour;
+                node->parent->colour = BLACK;
+                sibling->right->colour = BLACK;
+                rotate_left(tree, node->parent);
+                node = tree->root;
+            }
+
+        } else {
+            sibling = node->parent->left;
+
+            if (sibling->colour == RED) {
+                sibling->colour = BLACK;
+                node->parent->colour = RED;
+                rotate_right(tree, node->parent);
+                sibling = node->parent->left;
+            }
+
+            if (sibling->right->colour == BLACK && sibling->left->colour == BLACK) {
+                sibling->colour = RED;
+                node = node->parent;
+            } else {
+                if (sibling->left->colour == BLACK) {
+                    sibling->right->colour = BLACK;
+                    sibling->colour = RED;
+                    rotate_left(tree, sibling);
+                    sibling = node->parent->left;
+                }
+                sibling->colour = node->parent->colour;
+                node->parent->colour = BLACK;
+                sibling->left->colour = BLACK;
+                rotate_right(tree, node->parent);
+                node = tree->root;
+            }
+        }
+    }
+
+    node->colour = BLACK;
+
+}
@@ -0,0 +1,91 @@
+/*
+ * rb_tree.h - Contains the red-black tree data structure and functions declarations
+ * Author: Tristan Thomas
+ * Date: 17-10-2026
+ */
+
+#ifndef RB_TREE_H
+#define RB_TREE_H
+
+typedef struct rb_tree rb_tree_t;
+typedef struct rb_node rb_node_t;
+typedef void (*tree_free_func)(void *);
+typedef int (*tree_compare_func)(void *, void *);
+
+
+/**
+ * Creates an empty red-black tree ordered by a comparison function
+ *
+ * @param compare Function returning <0, 0 or >0 when comparing two data elements
+ * @return Empty tree
+ */
+rb_tree_t *create_tree(tree_compare_func compare);
+
+/**
+ * Inserts a data element into the tree
+ *
+ * @param tree Tree to be inserted into
+ * @param data Data element
+ * @return Tree node holding the data (handle for later deletion)
+ */
+rb_node_t *tree_insert(rb_tree_t *tree, void *data);
+
+/**
+ * Deletes a node from the tree and frees it (data is not freed)
+ *
+ * @param tree Tree to be deleted from
+ * @param node Node to be deleted
+ */
+void tree_delete(rb_tree_t *tree, rb_node_t *node);
+
+/**
+ * Finds the leftmost node whose data is not less than a key
+ *
+ * @param tree Tree to be searched
+ * @param key Key to compare against
+ * @param compare_key Function comparing a data element (first argument) with the key (second argument)
+ * @return Leftmost node with compare_key(data, key) >= 0 or NULL if there is none
+ */
+rb_node_t *tree_lower_bound(rb_tree_t *tree, void *key, tree_compare_func compare_key);
+
+/**
+ * Gets the node with the smallest data element
+ *
+ * @param tree Specified tree
+ * @return Minimum node or NULL if tree is empty
+ */
+rb_node_t *tree_min(rb_tree_t *tree);
+
+/**
+ * Gets the node with the largest data element
+ *
+ * @param tree Specified tree
+ * @return Maximum node or NULL if tree is empty
+ */
+rb_node_t *tree_max(rb_tree_t *tree);
+
+/**
+ * Gets the data of a tree node
+ *
+ * @param node Specified node
+ * @return Data of node
+ */
+void *get_tree_data(rb_node_t *node);
+
+/**
+ * Gets the number of items in the tree
+ *
+ * @param tree Specified tree
+ * @return Number of items
+ */
+int get_tree_size(rb_tree_t *tree);
+
+/**
+ * Frees a tree and its data
+ *
+ * @param tree Tree to be freed
+ * @param free_data Function for freeing data
+ */
+void free_tree(rb_tree_t *tree, tree_free_func free_data);
+
+#endif
@@ -0,0 +1,162 @@
+/*
+ * ring_buffer.c - Contains the ring buffer queue, a growable power of two array of data elements
+ * Author: Tristan Thomas
+ * Date: 17-10-2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "ring_buffer.h"
+
+/* Definition of a ring buffer, where the elements run from head (wrapping around the end of the array) */
+struct ring_buffer {
+    void **data;
+    // capacity - 1, as the capacity is a power of two
+    unsigned int mask;
+    unsigned int head;
+    int size;
+};
+
+static void grow_ring(ring_buffer_t *ring);
+
+
+/**
+ * Creates an empty ring buffer
+ *
+ * @return Empty ring buffer
+ */
+ring_buffer_t *create_ring_buffer() {
+
+    ring_buffer_t *ring = malloc(sizeof(*ring));
+    assert(ring);
+    ring->data = malloc(INIT_RING_SIZE * sizeof(*ring->data));
+    assert(ring->data);
+
+    ring->mask = INIT_RING_SIZE - 1;
+    ring->head = 0;
+    ring->size = 0;
+
+    return ring;
+
+}
+
+/**
+ * Adds a data element to the back of the ring buffer, doubling its capacity if it is full
+ *
+ * @param ring Ring buffer
+ * @param data Data element to be added
+ */
+void ring_push_back(ring_buffer_t *ring, void *data) {
+
+    if ((unsigned int) ring->size > ring->mask) {
+        grow_ring(ring);
+    }
+
+    ring->data[(ring->head + ring->size) & ring->mask] = data;
+    ring->size++;
+
+}
+
+/**
+ * Removes the data element at the front of the ring buffer
+ *
+ * @param ring Ring buffer
+ * @return Data element or NULL if the ring buffer is empty
+ */
+void *ring_pop_front(ring_buffer_t *ring) {
+
+    if (ring->size == 0) {
+        return NULL;
+    }
+
+    void *data = ring->data[ring->head];
+    ring->head = (ring->head + 1) & ring->mask;
+    ring->size--;
+
+    return data;
+
+}
+
+/**
+ * Removes the data element at the back of the ring buffer
+ *
+ * @param ring Ring buffer
+ * @return Data element or NULL if the ring buffer is empty
+ */
+void *ring_pop_back(ring_buffer_t *ring) {
+
+    if (ring->size == 0) {
+        return NULL;
+    }
+
+    ring->size--;
+
+    return ring->data[(ring->head + ring->size) & ring->mask];
+
+}
+
+/**
+ * Gets the number of data elements in the ring buffer
+ *
+ * @param ring Ring buffer
+ * @return Number of data elements
+ */
+int get_ring_size(ring_buffer_t *ring) {
+
+    return ring->size;
+}
+
+/**
+ * Checks if the ring buffer is empty
+ *
+ * @param ring Ring buffer to be checked
+ * @return 1 if empty, 0 if not
+ */
+int is_empty_ring(ring_buffer_t *ring) {
+
+    return (ring->size == 0);
+}
+
+/**
+ * Frees the ring buffer
+ *
+ * @param ring Ring buffer to be freed
+ * @param free_data Function that frees data elements still in the ring buffer
+ */
+void free_ring_buffer(ring_buffer_t *ring, ring_free_func free_data) {
+
+    for (int i = 0; i < ring->size; i++) {
+        free_data(ring->data[(ring->head + i) & ring->mask]);
+    }
+
+    free(ring->data);
+    free(ring);
+    ring = NULL;
+
+}
+
+/**
+ * Doubles the capacity of a full ring buffer
+ * The elements from head to the end of the array are moved to the end of the new array, so the elements that had
+ * wrapped around to the start stay where they are
+ *
+ * @param ring Full ring buffer
+ */
+static void grow_ring(ring_buffer_t *ring) {
+
+    unsigned int capacity = ring->mask + 1;
+
+    ring->data = realloc(ring->data, 2 * capacity * sizeof(*ring->data));
+    assert(ring->data);
+
+    if (ring->head > 0) {
+        memmove(&ring->data[ring->head + capacity], &ring->data[ring->head],
+                (capacity - ring->head) * sizeof(*ring->data));
+        ring->head += capacity;
+    }
+    ring->mask = 2 * capacity - 1;
+
+}
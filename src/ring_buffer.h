@@ -0,0 +1,72 @@
+/*
+ * ring_buffer.h - Contains the interface for the ring buffer queue of data elements (the round robin ready queue)
+ * Author: Tristan Thomas
+ * Date: 17-10-2026
+ */
+
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+// capacity is always a power of two, so positions wrap around with a mask instead of a division
+#define INIT_RING_SIZE 16
+
+typedef struct ring_buffer ring_buffer_t;
+typedef void (*ring_free_func)(void *);
+
+
+/**
+ * Creates an empty ring buffer
+ *
+ * @return Empty ring buffer
+ */
+ring_buffer_t *create_ring_buffer();
+
+/**
+ * Adds a data element to the back of the ring buffer, doubling its capacity if it is full
+ *
+ * @param ring Ring buffer
+ * @param data Data element to be added
+ */
+void ring_push_back(ring_buffer_t *ring, void *data);
+
+/**
+ * Removes the data element at the front of the ring buffer
+ *
+ * @param ring Ring buffer
+ * @return Data element or NULL if the ring buffer is empty
+ */
+void *ring_pop_front(ring_buffer_t *ring);
+
+/**
+ * Removes the data element at the back of the ring buffer
+ *
+ * @param ring Ring buffer
+ * @return Data element or NULL if the ring buffer is empty
+ */
+void *ring_pop_back(ring_buffer_t *ring);
+
+/**
+ * Gets the number of data elements in the ring buffer
+ *
+ * @param ring Ring buffer
+ * @return Number of data elements
+ */
+int get_ring_size(ring_buffer_t *ring);
+
+/**
+ * Checks if the ring buffer is empty
+ *
+ * @param ring Ring buffer to be checked
+ * @return 1 if empty, 0 if not
+ */
+int is_empty_ring(ring_buffer_t *ring);
+
+/**
+ * Frees the ring buffer
+ *
+ * @param ring Ring buffer to be freed
+ * @param free_data Function that frees data elements still in the ring buffer
+ */
+void free_ring_buffer(ring_buffer_t *ring, ring_free_func free_data);
+
+#endif
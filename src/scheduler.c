@@ -0,0 +1,1508 @@
+/*
+ * scheduler.c - Contains the simulated CPUs and the scheduling algorithms, each of which keeps its own ready queues
+ * Author: Tristan Thomas
+ * Date: 17-10-2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+#include <inttypes.h>
+
+#include "scheduler.h"
+#include "process_data.h"
+#include "linked_list.h"
+#include "min_heap.h"
+#include "level_queue.h"
+#include "rb_tree.h"
+#include "ring_buffer.h"
+
+/* Definition of a scheduling algorithm, resolved once from its name so the simulation loop never compares names */
+struct scheduler {
+    char *name;
+    // creates the ready queue of each CPU and sets the number of levels and boost interval
+    void (*init)(machine_t *);
+    // called when a process that has been allocated memory is given to a CPU, before it is added (NULL if unused)
+    void (*on_admit)(machine_t *, cpu_t *, process_t *);
+    // adds a process to the ready queue of a CPU (the level is only used by multi-level schedulers)
+    void (*on_ready)(machine_t *, cpu_t *, process_t *, int);
+    // adds processes that have just been admitted to the ready queue of a CPU at once (NULL to add each with on_ready)
+    void (*on_ready_batch)(machine_t *, cpu_t *, process_t **, int);
+    // takes the next process to run from the ready queue of a CPU and sets its level (NULL if nothing is waiting)
+    process_t *(*pick_next)(machine_t *, cpu_t *, int *);
+    // takes a waiting process from the first CPU for the second (idle) CPU and sets its level
+    process_t *(*steal)(machine_t *, cpu_t *, cpu_t *, int *);
+    // called after the running process ran a cycle of the given length without finishing (NULL if nothing changes)
+    void (*on_cycle)(machine_t *, cpu_t *, int);
+    // checks whether the running process should be switched out at the start of a cycle (NULL if it never is)
+    int (*on_quantum_end)(machine_t *, cpu_t *);
+    // time of the next cycle in which on_quantum_end could switch or change something (NULL if only arrivals and
+    // completions do)
+    uint64_t (*next_expiry)(machine_t *, cpu_t *, uint32_t, int);
+    // called when the running process finishes in a cycle of the given length (NULL if there is nothing to do)
+    void (*on_finish)(machine_t *, cpu_t *, int);
+    // moves waiting processes up levels, given the number of intervals since the last boost (NULL if never)
+    void (*boost)(machine_t *, uint64_t);
+    // whether boosts also change running processes, so matter while any are running rather than only while waiting
+    int boosts_running;
+    // number of processes waiting for a CPU
+    int (*size)(machine_t *, cpu_t *);
+    // frees the ready queue of a CPU
+    void (*free)(void *);
+    // prints statistics specific to the scheduler, given the finished processes (NULL if there are none)
+    void (*print_stats)(machine_t *, list_t *);
+};
+
+static void init_heaps(machine_t *machine);
+static void heap_ready(machine_t *machine, cpu_t *cpu, process_t *process, int level);
+static void heap_ready_batch(machine_t *machine, cpu_t *cpu, process_t **processes, int num_processes);
+static process_t *heap_pick(machine_t *machine, cpu_t *cpu, int *level);
+static process_t *heap_steal(machine_t *machine, cpu_t *victim, cpu_t *thief, int *level);
+static int heap_size(machine_t *machine, cpu_t *cpu);
+static void free_heap_queue(void *ready);
+static void init_remaining_heaps(machine_t *machine);
+static uint64_t remaining_key(void *data);
+static void indexed_ready(machine_t *machine, cpu_t *cpu, process_t *process, int level);
+static process_t *indexed_pick(machine_t *machine, cpu_t *cpu, int *level);
+static process_t *indexed_steal(machine_t *machine, cpu_t *victim, cpu_t *thief, int *level);
+static void srtf_cycle(machine_t *machine, cpu_t *cpu, int quantum);
+static int srtf_quantum_end(machine_t *machine, cpu_t *cpu);
+static void init_deadline_heaps(machine_t *machine);
+static int edf_quantum_end(machine_t *machine, cpu_t *cpu);
+static void indexed_finish(machine_t *machine, cpu_t *cpu, int quantum);
+static int indexed_size(machine_t *machine, cpu_t *cpu);
+static void init_rings(machine_t *machine);
+static void rr_ready(machine_t *machine, cpu_t *cpu, process_t *process, int level);
+static process_t *rr_pick(machine_t *machine, cpu_t *cpu, int *level);
+static process_t *rr_steal(machine_t *machine, cpu_t *victim, cpu_t *thief, int *level);
+static int rr_quantum_end(machine_t *machine, cpu_t *cpu);
+static uint64_t rr_expiry(machine_t *machine, cpu_t *cpu, uint32_t sim_time, int quantum);
+static int rr_size(machine_t *machine, cpu_t *cpu);
+static void free_ring_queue(void *ready);
+static void init_feedback_levels(machine_t *machine);
+static void init_priority_levels(machine_t *machine);
+static void level_ready(machine_t *machine, cpu_t *cpu, process_t *process, int level);
+static void priority_ready(machine_t *machine, cpu_t *cpu, process_t *process, int level);
+static process_t *level_pick(machine_t *machine, cpu_t *cpu, int *level);
+static process_t *level_steal(machine_t *machine, cpu_t *victim, cpu_t *thief, int *level);
+static int mlfq_quantum_end(machine_t *machine, cpu_t *cpu);
+static uint64_t mlfq_expiry(machine_t *machine, cpu_t *cpu, uint32_t sim_time, int quantum);
+static int priority_quantum_end(machine_t *machine, cpu_t *cpu);
+static uint64_t priority_expiry(machine_t *machine, cpu_t *cpu, uint32_t sim_time, int quantum);
+static void mlfq_boost(machine_t *machine, uint64_t num_intervals);
+static void priority_boost(machine_t *machine, uint64_t num_intervals);
+static int level_size(machine_t *machine, cpu_t *cpu);
+static void free_levels(void *ready);
+static void print_level_statistics(machine_t *machine, list_t *finished);
+static void init_pass_heaps(machine_t *machine);
+static void stride_admit(machine_t *machine, cpu_t *cpu, process_t *process);
+static process_t *stride_steal(machine_t *machine, cpu_t *victim, cpu_t *thief, int *level);
+static void stride_cycle(machine_t *machine, cpu_t *cpu, int quantum);
+static int stride_quantum_end(machine_t *machine, cpu_t *cpu);
+static uint64_t stride_expiry(machine_t *machine, cpu_t *cpu, uint32_t sim_time, int quantum);
+static void stride_finish(machine_t *machine, cpu_t *cpu, int quantum);
+static void print_share_statistics(machine_t *machine, list_t *finished);
+static void init_vruntime_trees(machine_t *machine);
+static uint64_t get_weight(process_t *process);
+static uint64_t get_slice(machine_t *machine, cpu_t *cpu);
+static uint64_t get_vruntime_step(process_t *process, int quantum);
+static void cfs_admit(machine_t *machine, cpu_t *cpu, process_t *process);
+static void cfs_ready(machine_t *machine, cpu_t *cpu, process_t *process, int level);
+static process_t *cfs_pick(machine_t *machine, cpu_t *cpu, int *level);
+static process_t *cfs_steal(machine_t *machine, cpu_t *victim, cpu_t *thief, int *level);
+static void cfs_cycle(machine_t *machine, cpu_t *cpu, int quantum);
+static int cfs_quantum_end(machine_t *machine, cpu_t *cpu);
+static uint64_t cfs_expiry(machine_t *machine, cpu_t *cpu, uint32_t sim_time, int quantum);
+static void cfs_finish(machine_t *machine, cpu_t *cpu, int quantum);
+static int cfs_size(machine_t *machine, cpu_t *cpu);
+static void free_cfs_tree(void *ready);
+
+static const scheduler_t schedulers[] = {
+        {"SJF", init_heaps, NULL, heap_ready, heap_ready_batch, heap_pick, heap_steal, NULL, NULL, NULL, NULL, NULL, 0,
+         heap_size, free_heap_queue, NULL},
+        {"SRTF", init_remaining_heaps, NULL, indexed_ready, heap_ready_batch, indexed_pick, indexed_steal, srtf_cycle,
+         srtf_quantum_end, NULL, indexed_finish, NULL, 0, indexed_size, free_heap_queue, NULL},
+        {"EDF", init_deadline_heaps, NULL, indexed_ready, heap_ready_batch, indexed_pick, indexed_steal, NULL,
+         edf_quantum_end, NULL, indexed_finish, NULL, 0, indexed_size, free_heap_queue, NULL},
+        {"RR", init_rings, NULL, rr_ready, NULL, rr_pick, rr_steal, NULL, rr_quantum_end, rr_expiry, NULL, NULL, 0,
+         rr_size, free_ring_queue, NULL},
+        {"MLFQ", init_feedback_levels, NULL, level_ready, NULL, level_pick, level_steal, NULL, mlfq_quantum_end,
+         mlfq_expiry, NULL, mlfq_boost, 1, level_size, free_levels, print_level_statistics},
+        {"PRIO", init_priority_levels, NULL, priority_ready, NULL, level_pick, level_steal, NULL, priority_quantum_end,
+         priority_expiry, NULL, priority_boost, 0, level_size, free_levels, NULL},
+        {"STRIDE", init_pass_heaps, stride_admit, heap_ready, heap_ready_batch, heap_pick, stride_steal, stride_cycle,
+         stride_quantum_end, stride_expiry, stride_finish, NULL, 0, heap_size, free_heap_queue,
+         print_share_statistics},
+        {"CFS", init_vruntime_trees, cfs_admit, cfs_ready, NULL, cfs_pick, cfs_steal, cfs_cycle, cfs_quantum_end,
+         cfs_expiry, cfs_finish, NULL, 0, cfs_size, free_cfs_tree, NULL},
+};
+
+#define NUM_SCHEDULERS (sizeof(schedulers) / sizeof(*schedulers))
+
+// CFS gives each process a slice of this period in proportion to its weight, but never less than the granularity
+#define CFS_LATENCY 24
+#define CFS_MIN_GRANULARITY 3
+#define NICE_0_WEIGHT 1024
+// virtual runtime is kept in units of 1/2^VRUNTIME_SHIFT of time so the heaviest weight still moves it every cycle
+#define VRUNTIME_SHIFT 10
+
+// load weight of each niceness from MIN_NICE to MAX_NICE (each step is about 10% more or less CPU time)
+static const uint64_t nice_weights[MAX_NICE - MIN_NICE + 1] = {
+        88761, 71755, 56483, 46273, 36291, 29154, 23254, 18705, 14949, 11916,
+        9548, 7620, 6100, 4904, 3906, 3121, 2501, 1991, 1586, 1277,
+        1024, 820, 655, 526, 423, 335, 272, 215, 172, 137,
+        110, 87, 70, 56, 45, 36, 29, 23, 18, 15
+};
+
+
+/**
+ * Finds a scheduling algorithm by name (exits if there is no such algorithm)
+ *
+ * @param name Name of scheduling algorithm
+ * @return Scheduling algorithm
+ */
+const scheduler_t *get_scheduler(char *name) {
+
+    for (size_t i = 0; i < NUM_SCHEDULERS; i++) {
+        if (strcmp(name, schedulers[i].name) == 0) {
+            return &schedulers[i];
+        }
+    }
+
+    fprintf(stderr, "Unknown scheduler: %s\n", name);
+    exit(EXIT_FAILURE);
+
+}
+
+/**
+ * Creates the simulated CPUs, each with an empty ready queue
+ *
+ * @param scheduler Scheduling algorithm to be used
+ * @param quantum Amount of time per cycle
+ * @param num_cpus Number of CPUs
+ * @param num_levels Number of levels of the multi-level feedback queue
+ * @param boost_interval Time between moving all processes to the top level of the multi-level feedback queue
+ * @param aging_interval Time between moving waiting processes up a priority level
+ * @return Machine with idle CPUs
+ */
+machine_t *create_machine(const scheduler_t *scheduler, int quantum, int num_cpus, int num_levels,
+                          uint32_t boost_interval, uint32_t aging_interval) {
+
+    machine_t *machine = malloc(sizeof(*machine));
+    assert(machine);
+    machine->cpus = malloc(num_cpus * sizeof(*machine->cpus));
+    assert(machine->cpus);
+
+    machine->scheduler = scheduler;
+    machine->quantum = quantum;
+    machine->num_cpus = num_cpus;
+    machine->num_levels = num_levels;
+    machine->boost_interval = boost_interval;
+    machine->aging_interval = aging_interval;
+    machine->boost = NULL;
+    machine->num_demotions = 0;
+    machine->num_boosts = 0;
+    machine->loads = malloc(num_cpus * sizeof(*machine->loads));
+    assert(machine->loads);
+    machine->batch = NULL;
+    machine->batch_cpus = NULL;
+    machine->batch_capacity = 0;
+
+    for (int i = 0; i < num_cpus; i++) {
+        machine->cpus[i].id = i;
+        machine->cpus[i].current_process = NULL;
+        machine->cpus[i].busy_time = 0;
+        machine->cpus[i].completion = NULL;
+        machine->cpus[i].quantum_expiry = NULL;
+        machine->cpus[i].level = 0;
+        machine->cpus[i].level_cycles = 0;
+        machine->cpus[i].weight = 0;
+        machine->cpus[i].virtual_time = 0;
+    }
+
+    // scheduler decides the number of levels and which interval boosts happen at
+    scheduler->init(machine);
+    machine->next_boost = machine->boost_interval;
+    machine->level_time = calloc(machine->num_levels, sizeof(*machine->level_time));
+    assert(machine->level_time);
+
+    return machine;
+
+}
+
+/**
+ * Frees the CPUs and any processes still waiting in their ready queues
+ *
+ * @param machine Machine to be freed
+ */
+void free_machine(machine_t *machine) {
+
+    for (int i = 0; i < machine->num_cpus; i++) {
+        machine->scheduler->free(machine->cpus[i].ready_queue);
+    }
+
+    free(machine->level_time);
+    free(machine->loads);
+    free(machine->batch);
+    free(machine->batch_cpus);
+    free(machine->cpus);
+    free(machine);
+    machine = NULL;
+
+}
+
+/**
+ * Adds processes that have been allocated memory in order, each to the ready queue of the CPU with the least
+ * processes (waiting or running), using the lowest numbered CPU if there is a tie
+ * CPUs are chosen as if the processes were added one at a time, then the processes given to each CPU are added to its
+ * ready queue at once
+ *
+ * @param machine Simulated CPUs
+ * @param processes Processes that are ready
+ * @param num_processes Number of processes
+ */
+void add_ready(machine_t *machine, process_t **processes, int num_processes) {
+
+    const scheduler_t *scheduler = machine->scheduler;
+    int least_loaded, num_batch;
+
+    if (num_processes > machine->batch_capacity) {
+        machine->batch_capacity = num_processes;
+        machine->batch = realloc(machine->batch, num_processes * sizeof(*machine->batch));
+        machine->batch_cpus = realloc(machine->batch_cpus, num_processes * sizeof(*machine->batch_cpus));
+        assert(machine->batch && machine->batch_cpus);
+    }
+
+    for (int i = 0; i < machine->num_cpus; i++) {
+        machine->loads[i] = scheduler->size(machine, &machine->cpus[i]) +
+                            (machine->cpus[i].current_process != NULL);
+    }
+    for (int i = 0; i < num_processes; i++) {
+        least_loaded = 0;
+        for (int j = 1; j < machine->num_cpus; j++) {
+            if (machine->loads[j] < machine->loads[least_loaded]) {
+                least_loaded = j;
+            }
+        }
+        machine->loads[least_loaded]++;
+        machine->batch_cpus[i] = least_loaded;
+        if (scheduler->on_admit) {
+            scheduler->on_admit(machine, &machine->cpus[least_loaded], processes[i]);
+        }
+    }
+
+    for (int i = 0; i < machine->num_cpus; i++) {
+        num_batch = 0;
+        for (int j = 0; j < num_processes; j++) {
+            if (machine->batch_cpus[j] == i) {
+                machine->batch[num_batch++] = processes[j];
+            }
+        }
+        if (num_batch == 0) {
+            continue;
+        }
+
+        if (scheduler->on_ready_batch) {
+            scheduler->on_ready_batch(machine, &machine->cpus[i], machine->batch, num_batch);
+        } else {
+            // new processes start on the top level
+            for (int j = 0; j < num_batch; j++) {
+                scheduler->on_ready(machine, &machine->cpus[i], machine->batch[j], 0);
+            }
+        }
+    }
+
+}
+
+/**
+ * Takes the next process for an idle CPU from its own ready queue, or steals one from the CPU with the most
+ * processes waiting if it has none
+ *
+ * @param machine Simulated CPUs
+ * @param cpu Idle CPU
+ * @param level Level of the process (always 0 other than for MLFQ and PRIO)
+ * @return Process to be ran (NULL if no processes are waiting)
+ */
+process_t *pick_next(machine_t *machine, cpu_t *cpu, int *level) {
+
+    cpu_t *busiest = NULL;
+    int size, busiest_size = 0;
+
+    *level = 0;
+    if (machine->scheduler->size(machine, cpu) > 0) {
+        return machine->scheduler->pick_next(machine, cpu, level);
+    }
+
+    for (int i = 0; i < machine->num_cpus; i++) {
+        size = machine->scheduler->size(machine, &machine->cpus[i]);
+        if (size > busiest_size) {
+            busiest = &machine->cpus[i];
+            busiest_size = size;
+        }
+    }
+
+    if (!busiest) {
+        return NULL;
+    }
+    return machine->scheduler->steal(machine, busiest, cpu, level);
+
+}
+
+/**
+ * Ends the quantum of the process running on a CPU, putting it back in the ready queue if it should be switched out
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU with a running process
+ * @param level Level of the next process (always 0 other than for MLFQ and PRIO)
+ * @return Process to be ran instead or NULL if the running process continues
+ */
+process_t *end_quantum(machine_t *machine, cpu_t *cpu, int *level) {
+
+    *level = 0;
+    if (!machine->scheduler->on_quantum_end || !machine->scheduler->on_quantum_end(machine, cpu)) {
+        return NULL;
+    }
+
+    machine->scheduler->on_ready(machine, cpu, cpu->current_process, cpu->level);
+    return machine->scheduler->pick_next(machine, cpu, level);
+
+}
+
+/**
+ * Runs the process on a CPU for a cycle, updating its service time and the ready queue
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU with a running process
+ * @param quantum Amount of time per cycle
+ * @return 1 if the process finished, 0 otherwise
+ */
+int run_cycle(machine_t *machine, cpu_t *cpu, int quantum) {
+
+    cpu->busy_time += quantum;
+    cpu->level_cycles++;
+    machine->level_time[cpu->level] += quantum;
+
+    if (update_time(quantum, cpu->current_process)) {
+        if (machine->scheduler->on_finish) {
+            machine->scheduler->on_finish(machine, cpu, quantum);
+        }
+        return 1;
+    }
+
+    if (machine->scheduler->on_cycle) {
+        machine->scheduler->on_cycle(machine, cpu, quantum);
+    }
+    return 0;
+
+}
+
+/**
+ * Gets the time of the next cycle in which the process running on a CPU could be switched out by end_quantum()
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU with a running process
+ * @param sim_time Current simulation time
+ * @param quantum Amount of time per cycle
+ * @return Simulation time of the quantum expiry or NO_EVENT if it only changes when a process arrives or finishes
+ */
+uint64_t next_expiry(machine_t *machine, cpu_t *cpu, uint32_t sim_time, int quantum) {
+
+    if (!machine->scheduler->next_expiry) {
+        return NO_EVENT;
+    }
+    return machine->scheduler->next_expiry(machine, cpu, sim_time, quantum);
+
+}
+
+/**
+ * Moves waiting processes up levels if a boost is due (MLFQ and PRIO only)
+ *
+ * @param machine Simulated CPUs
+ * @param sim_time Current simulation time
+ */
+void boost_if_due(machine_t *machine, uint32_t sim_time) {
+
+    uint64_t num_intervals;
+
+    if (!machine->scheduler->boost || sim_time < machine->next_boost) {
+        return;
+    }
+
+    // several intervals may have passed in one cycle
+    num_intervals = (sim_time - machine->next_boost) / machine->boost_interval + 1;
+    machine->scheduler->boost(machine, num_intervals);
+
+    machine->num_boosts++;
+    machine->next_boost = ((uint64_t) sim_time / machine->boost_interval + 1) * machine->boost_interval;
+
+}
+
+/**
+ * Moves the next boost past the cycles skipped before the next event if boosts would change nothing in them, so that
+ * processes are only aged for the intervals they spent waiting
+ *
+ * @param machine Simulated CPUs
+ * @param next_time Simulation time of the next cycle with an event
+ */
+void skip_boosts(machine_t *machine, uint64_t next_time) {
+
+    uint64_t last_skipped;
+
+    if (next_boost_time(machine) != NO_EVENT || !machine->scheduler->boost) {
+        return;
+    }
+
+    // boosts due up to the cycle before the next event would have found nothing to move
+    last_skipped = next_time - machine->quantum;
+    if (machine->next_boost <= last_skipped) {
+        machine->next_boost = (last_skipped / machine->boost_interval + 1) * machine->boost_interval;
+    }
+
+}
+
+/**
+ * Gets the time of the next boost
+ *
+ * @param machine Simulated CPUs
+ * @return Simulation time of the next boost or NO_EVENT if the scheduler has none or it would change nothing
+ */
+uint64_t next_boost_time(machine_t *machine) {
+
+    // multi-level feedback queue boosts only matter while processes are running (otherwise nothing is waiting either),
+    // and aging only while processes are waiting
+    if (!machine->scheduler->boost ||
+        !(machine->scheduler->boosts_running ? count_running(machine) : count_waiting(machine))) {
+        return NO_EVENT;
+    }
+    return machine->next_boost;
+
+}
+
+/**
+ * Counts the processes waiting in all ready queues
+ *
+ * @param machine Simulated CPUs
+ * @return Number of waiting processes
+ */
+int count_waiting(machine_t *machine) {
+
+    int num_waiting = 0;
+
+    for (int i = 0; i < machine->num_cpus; i++) {
+        num_waiting += machine->scheduler->size(machine, &machine->cpus[i]);
+    }
+
+    return num_waiting;
+
+}
+
+/**
+ * Counts the CPUs that are running a process
+ *
+ * @param machine Simulated CPUs
+ * @return Number of running processes
+ */
+int count_running(machine_t *machine) {
+
+    int num_running = 0;
+
+    for (int i = 0; i < machine->num_cpus; i++) {
+        num_running += machine->cpus[i].current_process != NULL;
+    }
+
+    return num_running;
+
+}
+
+/**
+ * Prints the utilization of each CPU if there is more than one, and statistics specific to the scheduler
+ *
+ * @param machine Simulated CPUs
+ * @param makespan Final simulation time
+ * @param finished List of completed processes
+ */
+void print_scheduler_statistics(machine_t *machine, uint32_t makespan, list_t *finished) {
+
+    if (machine->num_cpus > 1) {
+        for (int i = 0; i < machine->num_cpus; i++) {
+            printf("CPU %d utilization %.2lf\n", i,
+                   makespan ? round((double) machine->cpus[i].busy_time / makespan * 100) / 100 : 0);
+        }
+    }
+
+    if (machine->scheduler->print_stats) {
+        machine->scheduler->print_stats(machine, finished);
+    }
+
+}
+
+/**
+ * Creates a min heap ordered by service time as the ready queue of each CPU (shortest job first)
+ *
+ * @param machine Simulated CPUs
+ */
+static void init_heaps(machine_t *machine) {
+
+    machine->num_levels = 1;
+    for (int i = 0; i < machine->num_cpus; i++) {
+        machine->cpus[i].ready_queue = create_heap();
+    }
+
+}
+
+/**
+ * Adds a process to a min heap ready queue
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU the process waits for
+ * @param process Process that is ready
+ * @param level Not used
+ */
+static void heap_ready(machine_t *machine, cpu_t *cpu, process_t *process, int level) {
+
+    insert_data(cpu->ready_queue, process);
+}
+
+/**
+ * Adds newly admitted processes to a min heap ready queue at once (none of them are already in it)
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU the processes wait for
+ * @param processes Processes that are ready
+ * @param num_processes Number of processes
+ */
+static void heap_ready_batch(machine_t *machine, cpu_t *cpu, process_t **processes, int num_processes) {
+
+    insert_batch(cpu->ready_queue, (void **) processes, num_processes);
+}
+
+/**
+ * Takes the shortest process from a min heap ready queue
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU that will run the process
+ * @param level Not used
+ * @return Shortest process
+ */
+static process_t *heap_pick(machine_t *machine, cpu_t *cpu, int *level) {
+
+    return (process_t *) extract_min(cpu->ready_queue);
+}
+
+/**
+ * Steals the shortest process from the min heap ready queue of another CPU
+ *
+ * @param machine Simulated CPUs
+ * @param victim CPU with processes waiting
+ * @param thief Idle CPU
+ * @param level Not used
+ * @return Stolen process
+ */
+static process_t *heap_steal(machine_t *machine, cpu_t *victim, cpu_t *thief, int *level) {
+
+    return (process_t *) extract_min(victim->ready_queue);
+}
+
+/**
+ * Gets the number of processes in a min heap ready queue
+ *
+ * @param machine Simulated CPUs
+ * @param cpu Specified CPU
+ * @return Number of waiting processes
+ */
+static int heap_size(machine_t *machine, cpu_t *cpu) {
+
+    return get_heap_size(cpu->ready_queue);
+}
+
+/**
+ * Frees a min heap ready queue (processes in a heap are not freed)
+ *
+ * @param ready Ready queue to be freed
+ */
+static void free_heap_queue(void *ready) {
+
+    free_heap(ready);
+}
+
+/**
+ * Creates an indexed min heap ordered by service time left as the ready queue of each CPU (shortest remaining time
+ * first), which also holds the running process so it can be moved up as its time left goes down
+ *
+ * @param machine Simulated CPUs
+ */
+static void init_remaining_heaps(machine_t *machine) {
+
+    machine->num_levels = 1;
+    for (int i = 0; i < machine->num_cpus; i++) {
+        machine->cpus[i].ready_queue = create_indexed_heap((heap_compare_func) compare_remaining, remaining_key);
+    }
+
+}
+
+/**
+ * Gets the service time left of a process as its key in the ready queue
+ *
+ * @param data Process
+ * @return Service time left
+ */
+static uint64_t remaining_key(void *data) {
+
+    return (uint64_t) get_value(data, SERVICE_TIME_LEFT);
+}
+
+/**
+ * Adds a process to an indexed min heap ready queue if it is not already there (as a switched out process is)
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU the process waits for
+ * @param process Process that is ready
+ * @param level Not used
+ */
+static void indexed_ready(machine_t *machine, cpu_t *cpu, process_t *process, int level) {
+
+    if (get_heap_index(process) == NOT_IN_HEAP) {
+        insert_data(cpu->ready_queue, process);
+    }
+}
+
+/**
+ * Gets the first process of an indexed min heap ready queue, which stays in the queue while it runs
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU that will run the process
+ * @param level Not used
+ * @return Process with the least time left for SRTF or the earliest deadline for EDF
+ */
+static process_t *indexed_pick(machine_t *machine, cpu_t *cpu, int *level) {
+
+    return (process_t *) peek_min(cpu->ready_queue);
+}
+
+/**
+ * Steals the first waiting process of the indexed min heap ready queue of another CPU, setting the running process
+ * of that CPU aside so that it is not taken
+ *
+ * @param machine Simulated CPUs
+ * @param victim CPU with processes waiting
+ * @param thief Idle CPU
+ * @param level Not used
+ * @return Stolen process
+ */
+static process_t *indexed_steal(machine_t *machine, cpu_t *victim, cpu_t *thief, int *level) {
+
+    process_t *process;
+
+    if (victim->current_process) {
+        remove_data(victim->ready_queue, victim->current_process);
+    }
+    process = (process_t *) extract_min(victim->ready_queue);
+    if (victim->current_process) {
+        insert_data(victim->ready_queue, victim->current_process);
+    }
+
+    insert_data(thief->ready_queue, process);
+
+    return process;
+
+}
+
+/**
+ * Moves the running process up its ready queue as its time left goes down
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU with a running process
+ * @param quantum Not used
+ */
+static void srtf_cycle(machine_t *machine, cpu_t *cpu, int quantum) {
+
+    update_data(cpu->ready_queue, cpu->current_process);
+}
+
+/**
+ * Checks whether a waiting process has strictly less time left than the running process
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU with a running process
+ * @return 1 if the process should be switched out, 0 otherwise (ties keep the running process)
+ */
+static int srtf_quantum_end(machine_t *machine, cpu_t *cpu) {
+
+    process_t *shortest = (process_t *) peek_min(cpu->ready_queue);
+
+    return get_value(shortest, SERVICE_TIME_LEFT) < get_value(cpu->current_process, SERVICE_TIME_LEFT);
+}
+
+/**
+ * Removes a finished process from its indexed min heap ready queue
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU whose process finished
+ * @param quantum Not used
+ */
+static void indexed_finish(machine_t *machine, cpu_t *cpu, int quantum) {
+
+    remove_data(cpu->ready_queue, cpu->current_process);
+}
+
+/**
+ * Gets the number of processes waiting in an indexed min heap ready queue (not counting the running process)
+ *
+ * @param machine Simulated CPUs
+ * @param cpu Specified CPU
+ * @return Number of waiting processes
+ */
+static int indexed_size(machine_t *machine, cpu_t *cpu) {
+
+    // the running process is only in the heap until on_finish removes it
+    return get_heap_size(cpu->ready_queue) -
+           (cpu->current_process != NULL && get_heap_index(cpu->current_process) != NOT_IN_HEAP);
+}
+
+/**
+ * Creates an indexed min heap ordered by absolute deadline as the ready queue of each CPU (earliest deadline first),
+ * which also holds the running process like shortest remaining time first
+ *
+ * @param machine Simulated CPUs
+ */
+static void init_deadline_heaps(machine_t *machine) {
+
+    machine->num_levels = 1;
+    for (int i = 0; i < machine->num_cpus; i++) {
+        machine->cpus[i].ready_queue = create_indexed_heap((heap_compare_func) compare_deadline,
+                                                             (heap_key_func) get_deadline);
+    }
+
+}
+
+/**
+ * Checks whether a waiting process has a strictly earlier deadline than the running process
+ * Deadlines do not change, so this can only happen after a process arrives (there is no quantum expiry)
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU with a running process
+ * @return 1 if the process should be switched out, 0 otherwise (ties keep the running process)
+ */
+static int edf_quantum_end(machine_t *machine, cpu_t *cpu) {
+
+    process_t *earliest = (process_t *) peek_min(cpu->ready_queue);
+
+    return get_deadline(earliest) < get_deadline(cpu->current_process);
+}
+
+/**
+ * Creates a ring buffer used as a deque as the ready queue of each CPU (round robin)
+ *
+ * @param machine Simulated CPUs
+ */
+static void init_rings(machine_t *machine) {
+
+    machine->num_levels = 1;
+    for (int i = 0; i < machine->num_cpus; i++) {
+        machine->cpus[i].ready_queue = create_ring_buffer();
+    }
+
+}
+
+/**
+ * Adds a process to the back of a round robin ready queue
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU the process waits for
+ * @param process Process that is ready
+ * @param level Not used
+ */
+static void rr_ready(machine_t *machine, cpu_t *cpu, process_t *process, int level) {
+
+    ring_push_back(cpu->ready_queue, process);
+}
+
+/**
+ * Takes the process at the front of a round robin ready queue
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU that will run the process
+ * @param level Not used
+ * @return Process at the front of the queue
+ */
+static process_t *rr_pick(machine_t *machine, cpu_t *cpu, int *level) {
+
+    return (process_t *) ring_pop_front(cpu->ready_queue);
+}
+
+/**
+ * Steals the process at the back of the round robin ready queue of another CPU, as that process would have waited
+ * the longest on its own CPU
+ *
+ * @param machine Simulated CPUs
+ * @param victim CPU with processes waiting
+ * @param thief Idle CPU
+ * @param level Not used
+ * @return Stolen process
+ */
+static process_t *rr_steal(machine_t *machine, cpu_t *victim, cpu_t *thief, int *level) {
+
+    return (process_t *) ring_pop_back(victim->ready_queue);
+}
+
+/**
+ * Checks whether another process is waiting, as round robin switches every quantum if one is
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU with a running process
+ * @return 1 if the process should be switched out, 0 otherwise
+ */
+static int rr_quantum_end(machine_t *machine, cpu_t *cpu) {
+
+    return !is_empty_ring(cpu->ready_queue);
+}
+
+/**
+ * Gets the time the running process is switched out if another process is waiting
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU with a running process
+ * @param sim_time Current simulation time
+ * @param quantum Amount of time per cycle
+ * @return End of the quantum or NO_EVENT if nothing is waiting
+ */
+static uint64_t rr_expiry(machine_t *machine, cpu_t *cpu, uint32_t sim_time, int quantum) {
+
+    // idle CPUs have already taken every process they could, so only its own queue matters
+    return is_empty_ring(cpu->ready_queue) ? NO_EVENT : (uint64_t) sim_time + quantum;
+}
+
+/**
+ * Gets the number of processes in a round robin ready queue
+ *
+ * @param machine Simulated CPUs
+ * @param cpu Specified CPU
+ * @return Number of waiting processes
+ */
+static int rr_size(machine_t *machine, cpu_t *cpu) {
+
+    return get_ring_size(cpu->ready_queue);
+}
+
+/**
+ * Frees a round robin ready queue and the processes in it
+ *
+ * @param ready Ready queue to be freed
+ */
+static void free_ring_queue(void *ready) {
+
+    free_ring_buffer(ready, (void (*)(void *)) free_process);
+}
+
+/**
+ * Creates a multi-level queue as the ready queue of each CPU (multi-level feedback queue)
+ *
+ * @param machine Simulated CPUs
+ */
+static void init_feedback_levels(machine_t *machine) {
+
+    for (int i = 0; i < machine->num_cpus; i++) {
+        machine->cpus[i].ready_queue = create_level_queue(machine->num_levels);
+    }
+
+}
+
+/**
+ * Creates a multi-level queue with a level per priority as the ready queue of each CPU (priority scheduling)
+ *
+ * @param machine Simulated CPUs
+ */
+static void init_priority_levels(machine_t *machine) {
+
+    machine->num_levels = MAX_PRIORITY + 1;
+    machine->boost_interval = machine->aging_interval;
+    for (int i = 0; i < machine->num_cpus; i++) {
+        machine->cpus[i].ready_queue = create_level_queue(machine->num_levels);
+    }
+
+}
+
+/**
+ * Adds a process to the back of a level of a multi-level ready queue
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU the process waits for
+ * @param process Process that is ready
+ * @param level Level of the process
+ */
+static void level_ready(machine_t *machine, cpu_t *cpu, process_t *process, int level) {
+
+    level_enqueue(cpu->ready_queue, level, get_queue_node(process));
+}
+
+/**
+ * Adds a process to the level of its priority, resetting any aging
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU the process waits for
+ * @param process Process that is ready
+ * @param level Not used
+ */
+static void priority_ready(machine_t *machine, cpu_t *cpu, process_t *process, int level) {
+
+    level_enqueue(cpu->ready_queue, (int) get_value(process, PRIORITY), get_queue_node(process));
+}
+
+/**
+ * Takes the process at the front of the highest level of a multi-level ready queue
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU that will run the process
+ * @param level Level the process was taken from
+ * @return Process at the front of the highest level
+ */
+static process_t *level_pick(machine_t *machine, cpu_t *cpu, int *level) {
+
+    return (process_t *) level_dequeue(cpu->ready_queue, level);
+}
+
+/**
+ * Steals the process at the back of the highest level of the multi-level ready queue of another CPU
+ *
+ * @param machine Simulated CPUs
+ * @param victim CPU with processes waiting
+ * @param thief Idle CPU
+ * @param level Level the process was taken from
+ * @return Stolen process
+ */
+static process_t *level_steal(machine_t *machine, cpu_t *victim, cpu_t *thief, int *level) {
+
+    return (process_t *) level_dequeue_back(victim->ready_queue, level);
+}
+
+/**
+ * Demotes a process that used its whole quantum, and checks whether a waiting process is on a higher level, or on
+ * the same level once the quantum is used
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU with a running process
+ * @return 1 if the process should be switched out, 0 otherwise
+ */
+static int mlfq_quantum_end(machine_t *machine, cpu_t *cpu) {
+
+    int expired, top;
+
+    // quantum of each level is double the one above it
+    expired = cpu->level_cycles >= (1UL << cpu->level);
+    if (expired) {
+        if (cpu->level < machine->num_levels - 1) {
+            cpu->level++;
+            machine->num_demotions++;
+        }
+        cpu->level_cycles = 0;
+    }
+
+    top = get_top_level(cpu->ready_queue);
+    return top != NO_LEVEL && (top < cpu->level || (expired && top == cpu->level));
+
+}
+
+/**
+ * Gets the time the quantum of the running process is used up
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU with a running process
+ * @param sim_time Current simulation time
+ * @param quantum Amount of time per cycle
+ * @return End of the quantum of the level (demotion changes the level even if nothing is waiting)
+ */
+static uint64_t mlfq_expiry(machine_t *machine, cpu_t *cpu, uint32_t sim_time, int quantum) {
+
+    return sim_time + ((1UL << cpu->level) - cpu->level_cycles) * quantum;
+}
+
+/**
+ * Checks whether a waiting process has a higher or the same priority, as processes with the same priority take
+ * turns each quantum
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU with a running process
+ * @return 1 if the process should be switched out, 0 otherwise
+ */
+static int priority_quantum_end(machine_t *machine, cpu_t *cpu) {
+
+    int top = get_top_level(cpu->ready_queue);
+
+    return top != NO_LEVEL && top <= cpu->level;
+}
+
+/**
+ * Gets the time the running process is switched out if a process with a higher or the same priority is waiting
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU with a running process
+ * @param sim_time Current simulation time
+ * @param quantum Amount of time per cycle
+ * @return End of the quantum or NO_EVENT if no such process is waiting (aging is a separate event)
+ */
+static uint64_t priority_expiry(machine_t *machine, cpu_t *cpu, uint32_t sim_time, int quantum) {
+
+    return priority_quantum_end(machine, cpu) ? (uint64_t) sim_time + quantum : NO_EVENT;
+}
+
+/**
+ * Moves every process to the top level of the multi-level feedback queue
+ *
+ * @param machine Simulated CPUs
+ * @param num_intervals Not used (boosting more than once changes nothing)
+ */
+static void mlfq_boost(machine_t *machine, uint64_t num_intervals) {
+
+    for (int i = 0; i < machine->num_cpus; i++) {
+        merge_levels(machine->cpus[i].ready_queue);
+        machine->cpus[i].level = 0;
+        machine->cpus[i].level_cycles = 0;
+    }
+
+}
+
+/**
+ * Moves waiting processes up a priority level for each aging interval that has passed
+ *
+ * @param machine Simulated CPUs
+ * @param num_intervals Number of aging intervals
+ */
+static void priority_boost(machine_t *machine, uint64_t num_intervals) {
+
+    for (int i = 0; i < machine->num_cpus; i++) {
+        for (uint64_t j = 0; j < num_intervals && j < (uint64_t) machine->num_levels; j++) {
+            age_levels(machine->cpus[i].ready_queue);
+        }
+    }
+
+}
+
+/**
+ * Gets the number of processes in a multi-level ready queue
+ *
+ * @param machine Simulated CPUs
+ * @param cpu Specified CPU
+ * @return Number of waiting processes
+ */
+static int level_size(machine_t *machine, cpu_t *cpu) {
+
+    return get_level_queue_size(cpu->ready_queue);
+}
+
+/**
+ * Frees a multi-level ready queue and the processes in it
+ *
+ * @param ready Ready queue to be freed
+ */
+static void free_levels(void *ready) {
+
+    free_level_queue(ready, (void (*)(void *)) free_process);
+}
+
+/**
+ * Prints the time spent running on each level and its share of all running time, and the number of demotions and
+ * boosts
+ *
+ * @param machine Simulated CPUs
+ * @param finished Not used
+ */
+static void print_level_statistics(machine_t *machine, list_t *finished) {
+
+    uint64_t total_time = 0;
+
+    for (int i = 0; i < machine->num_levels; i++) {
+        total_time += machine->level_time[i];
+    }
+    for (int i = 0; i < machine->num_levels; i++) {
+        printf("Level %d residency %" PRIu64 " %.2lf\n", i, machine->level_time[i],
+               total_time ? round((double) machine->level_time[i] / total_time * 100) / 100 : 0);
+    }
+    printf("Demotions %lu\n", machine->num_demotions);
+    printf("Boosts %lu\n", machine->num_boosts);
+
+}
+
+/**
+ * Creates a min heap ordered by pass as the ready queue of each CPU (stride scheduling)
+ *
+ * @param machine Simulated CPUs
+ */
+static void init_pass_heaps(machine_t *machine) {
+
+    machine->num_levels = 1;
+    for (int i = 0; i < machine->num_cpus; i++) {
+        machine->cpus[i].ready_queue = create_ordered_heap((heap_compare_func) compare_pass, (heap_key_func) get_pass);
+    }
+
+}
+
+/**
+ * Adds the tickets of a process to a CPU, and moves its pass up to the pass of the CPU so that it cannot make up for
+ * time before it joined by running alone
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU the process joins
+ * @param process Process joining the CPU
+ */
+static void stride_admit(machine_t *machine, cpu_t *cpu, process_t *process) {
+
+    cpu->weight += (uint64_t) get_value(process, TICKETS);
+    if (get_pass(process) < cpu->virtual_time) {
+        set_pass(process, cpu->virtual_time);
+    }
+    join_share(process, cpu->virtual_time, cpu->busy_time);
+
+}
+
+/**
+ * Steals the process with the lowest pass from another CPU, moving its tickets to the idle CPU
+ *
+ * @param machine Simulated CPUs
+ * @param victim CPU with processes waiting
+ * @param thief Idle CPU
+ * @param level Not used
+ * @return Stolen process
+ */
+static process_t *stride_steal(machine_t *machine, cpu_t *victim, cpu_t *thief, int *level) {
+
+    process_t *process = (process_t *) extract_min(victim->ready_queue);
+
+    leave_share(process, victim->virtual_time, victim->busy_time);
+    victim->weight -= (uint64_t) get_value(process, TICKETS);
+    stride_admit(machine, thief, process);
+
+    return process;
+
+}
+
+/**
+ * Advances the pass of the running process by its stride and the pass of its CPU by the stride of all its tickets,
+ * each scaled by the cycle length
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU with a running process
+ * @param quantum Amount of time per cycle
+ */
+static void stride_cycle(machine_t *machine, cpu_t *cpu, int quantum) {
+
+    process_t *process = cpu->current_process;
+
+    set_pass(process, get_pass(process) + (uint64_t) STRIDE1 * quantum / (uint64_t) get_value(process, TICKETS));
+    cpu->virtual_time += (uint64_t) STRIDE1 * quantum / cpu->weight;
+
+}
+
+/**
+ * Checks whether a waiting process has a strictly lower pass than the running process
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU with a running process
+ * @return 1 if the process should be switched out, 0 otherwise (ties keep the running process)
+ */
+static int stride_quantum_end(machine_t *machine, cpu_t *cpu) {
+
+    process_t *lowest = (process_t *) peek_min(cpu->ready_queue);
+
+    return lowest && get_pass(lowest) < get_pass(cpu->current_process);
+}
+
+/**
+ * Gets the time the pass of the running process goes past the lowest waiting pass
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU with a running process
+ * @param sim_time Current simulation time
+ * @param quantum Amount of time per cycle
+ * @return Start of the first cycle the process is switched out in or NO_EVENT if nothing is waiting
+ */
+static uint64_t stride_expiry(machine_t *machine, cpu_t *cpu, uint32_t sim_time, int quantum) {
+
+    process_t *lowest = (process_t *) peek_min(cpu->ready_queue);
+    uint64_t pass, step;
+
+    if (!lowest) {
+        return NO_EVENT;
+    }
+
+    // pass goes up by the same step every cycle, and is still at most the lowest waiting pass
+    pass = get_pass(cpu->current_process);
+    step = (uint64_t) STRIDE1 * quantum / (uint64_t) get_value(cpu->current_process, TICKETS);
+    return sim_time + ((get_pass(lowest) - pass) / step + 1) * quantum;
+
+}
+
+/**
+ * Removes the tickets of a finished process from its CPU
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU whose process finished
+ * @param quantum Amount of time per cycle
+ */
+static void stride_finish(machine_t *machine, cpu_t *cpu, int quantum) {
+
+    // the last cycle still counts towards the entitlement of every process on the CPU
+    stride_cycle(machine, cpu, quantum);
+    leave_share(cpu->current_process, cpu->virtual_time, cpu->busy_time);
+    cpu->weight -= (uint64_t) get_value(cpu->current_process, TICKETS);
+
+}
+
+/**
+ * Prints the share of a CPU each process got, and the share its tickets entitled it to, while it was waiting for or
+ * running on a CPU
+ *
+ * @param machine Simulated CPUs
+ * @param finished List of completed processes
+ */
+static void print_share_statistics(machine_t *machine, list_t *finished) {
+
+    process_t *process;
+
+    for (node_t *curr = get_head(finished); curr; curr = get_next(curr)) {
+        process = (process_t *) get_data(curr);
+        printf("Share %s %.2lf %.2lf\n", get_name(process), get_value(process, ACHIEVED_SHARE),
+               get_value(process, TARGET_SHARE));
+    }
+
+}
+
+/**
+ * Creates a red-black tree ordered by virtual runtime as the ready queue of each CPU (completely fair scheduling)
+ * The running process is taken out of the tree while it runs
+ *
+ * @param machine Simulated CPUs
+ */
+static void init_vruntime_trees(machine_t *machine) {
+
+    machine->num_levels = 1;
+    for (int i = 0; i < machine->num_cpus; i++) {
+        machine->cpus[i].ready_queue = create_tree((tree_compare_func) compare_vruntime);
+    }
+
+}
+
+/**
+ * Gets the load weight of a process from its niceness
+ *
+ * @param process Specified process
+ * @return Load weight (NICE_0_WEIGHT for niceness 0)
+ */
+static uint64_t get_weight(process_t *process) {
+
+    return nice_weights[(int) get_value(process, NICE) - MIN_NICE];
+}
+
+/**
+ * Gets the time the running process may run for before a waiting process with a lower virtual runtime takes over,
+ * which is its share of the latency by weight, so slices get shorter as more processes are runnable
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU with a running process
+ * @return Slice length
+ */
+static uint64_t get_slice(machine_t *machine, cpu_t *cpu) {
+
+    uint64_t slice = CFS_LATENCY * get_weight(cpu->current_process) / cpu->weight;
+
+    return slice > CFS_MIN_GRANULARITY ? slice : CFS_MIN_GRANULARITY;
+}
+
+/**
+ * Gets how much the virtual runtime of a process goes up by in a cycle, which is the cycle length scaled down by its
+ * weight
+ *
+ * @param process Running process
+ * @param quantum Amount of time per cycle
+ * @return Virtual runtime step
+ */
+static uint64_t get_vruntime_step(process_t *process, int quantum) {
+
+    return ((uint64_t) quantum << VRUNTIME_SHIFT) * NICE_0_WEIGHT / get_weight(process);
+}
+
+/**
+ * Adds the weight of a process to a CPU, and moves its virtual runtime up to the minimum virtual runtime of the CPU
+ * so that it cannot make up for time before it joined by running alone
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU the process joins
+ * @param process Process joining the CPU
+ */
+static void cfs_admit(machine_t *machine, cpu_t *cpu, process_t *process) {
+
+    cpu->weight += get_weight(process);
+    if (get_vruntime(process) < cpu->virtual_time) {
+        set_vruntime(process, cpu->virtual_time);
+    }
+
+}
+
+/**
+ * Adds a process to a red-black tree ready queue
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU the process waits for
+ * @param process Process that is ready
+ * @param level Not used
+ */
+static void cfs_ready(machine_t *machine, cpu_t *cpu, process_t *process, int level) {
+
+    tree_insert(cpu->ready_queue, process);
+}
+
+/**
+ * Takes the process with the lowest virtual runtime out of a red-black tree ready queue
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU that will run the process
+ * @param level Not used
+ * @return Process with the lowest virtual runtime
+ */
+static process_t *cfs_pick(machine_t *machine, cpu_t *cpu, int *level) {
+
+    rb_node_t *leftmost = tree_min(cpu->ready_queue);
+    process_t *process = (process_t *) get_tree_data(leftmost);
+
+    tree_delete(cpu->ready_queue, leftmost);
+
+    return process;
+
+}
+
+/**
+ * Steals the process with the lowest virtual runtime from another CPU, moving its weight to the idle CPU and keeping
+ * how far it is ahead of the minimum virtual runtime of its CPU
+ *
+ * @param machine Simulated CPUs
+ * @param victim CPU with processes waiting
+ * @param thief Idle CPU
+ * @param level Not used
+ * @return Stolen process
+ */
+static process_t *cfs_steal(machine_t *machine, cpu_t *victim, cpu_t *thief, int *level) {
+
+    process_t *process = cfs_pick(machine, victim, level);
+    uint64_t lag = get_vruntime(process) - victim->virtual_time;
+
+    victim->weight -= get_weight(process);
+    thief->weight += get_weight(process);
+    set_vruntime(process, thief->virtual_time + lag);
+
+    return process;
+
+}
+
+/**
+ * Advances the virtual runtime of the running process by the cycle length scaled down by its weight, and the minimum
+ * virtual runtime of its CPU up to the lowest virtual runtime of its processes
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU with a running process
+ * @param quantum Amount of time per cycle
+ */
+static void cfs_cycle(machine_t *machine, cpu_t *cpu, int quantum) {
+
+    process_t *process = cpu->current_process;
+    uint64_t lowest;
+    rb_node_t *leftmost;
+
+    set_vruntime(process, get_vruntime(process) + get_vruntime_step(process, quantum));
+
+    lowest = get_vruntime(process);
+    if ((leftmost = tree_min(cpu->ready_queue)) && get_vruntime(get_tree_data(leftmost)) < lowest) {
+        lowest = get_vruntime(get_tree_data(leftmost));
+    }
+    // never goes down, so processes that join later never start behind
+    if (lowest > cpu->virtual_time) {
+        cpu->virtual_time = lowest;
+    }
+
+}
+
+/**
+ * Checks whether the running process has used its slice and a waiting process has a strictly lower virtual runtime
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU with a running process
+ * @return 1 if the process should be switched out, 0 otherwise
+ */
+static int cfs_quantum_end(machine_t *machine, cpu_t *cpu) {
+
+    rb_node_t *leftmost = tree_min(cpu->ready_queue);
+
+    return leftmost && cpu->level_cycles * machine->quantum >= get_slice(machine, cpu) &&
+           get_vruntime(get_tree_data(leftmost)) < get_vruntime(cpu->current_process);
+}
+
+/**
+ * Gets the time the running process has used its slice and its virtual runtime has gone past the lowest waiting one
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU with a running process
+ * @param sim_time Current simulation time
+ * @param quantum Amount of time per cycle
+ * @return Start of the first cycle the process is switched out in or NO_EVENT if nothing is waiting
+ */
+static uint64_t cfs_expiry(machine_t *machine, cpu_t *cpu, uint32_t sim_time, int quantum) {
+
+    rb_node_t *leftmost = tree_min(cpu->ready_queue);
+    uint64_t slice_cycles, cycles = 1, lowest, vruntime, step;
+
+    if (!leftmost) {
+        return NO_EVENT;
+    }
+
+    // cycles until the slice is used
+    slice_cycles = (get_slice(machine, cpu) + quantum - 1) / quantum;
+    if (slice_cycles > cpu->level_cycles + cycles) {
+        cycles = slice_cycles - cpu->level_cycles;
+    }
+
+    // cycles until the virtual runtime, which goes up by the same step every cycle, is past the lowest waiting one
+    lowest = get_vruntime(get_tree_data(leftmost));
+    vruntime = get_vruntime(cpu->current_process);
+    step = get_vruntime_step(cpu->current_process, quantum);
+    if (lowest >= vruntime && (lowest - vruntime) / step + 1 > cycles) {
+        cycles = (lowest - vruntime) / step + 1;
+    }
+
+    return sim_time + cycles * quantum;
+
+}
+
+/**
+ * Removes the weight of a finished process from its CPU
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU whose process finished
+ * @param quantum Amount of time per cycle
+ */
+static void cfs_finish(machine_t *machine, cpu_t *cpu, int quantum) {
+
+    cfs_cycle(machine, cpu, quantum);
+    cpu->weight -= get_weight(cpu->current_process);
+}
+
+/**
+ * Gets the number of processes in a red-black tree ready queue
+ *
+ * @param machine Simulated CPUs
+ * @param cpu Specified CPU
+ * @return Number of waiting processes
+ */
+static int cfs_size(machine_t *machine, cpu_t *cpu) {
+
+    return get_tree_size(cpu->ready_queue);
+}
+
+/**
+ * Frees a red-black tree ready queue and the processes in it
+ *
+ * @param ready Ready queue to be freed
+ */
+static void free_cfs_tree(void *ready) {
+
+    free_tree(ready, (tree_free_func) free_process);
+}
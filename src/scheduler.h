@@ -0,0 +1,193 @@
+/*
+ * scheduler.h - Contains the interface for the simulated CPUs and the scheduling algorithms that fill their queues
+ * Author: Tristan Thomas
+ * Date: 17-10-2026
+ */
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <stdint.h>
+
+#include "event_queue.h"
+
+typedef struct scheduler scheduler_t;
+typedef struct cpu cpu_t;
+typedef struct machine machine_t;
+typedef struct process process_t;
+typedef struct list list_t;
+
+/* Definitions of a simulated CPU and the machine made up of them (shared with the simulation loop) */
+struct cpu {
+    int id;
+    process_t *current_process;
+    // processes waiting for this CPU (data structure depending on scheduling algorithm)
+    void *ready_queue;
+    // time this CPU spent running processes
+    uint64_t busy_time;
+    // completion and quantum expiry of the running process (NULL if there is none)
+    event_t *completion;
+    event_t *quantum_expiry;
+    // level of the running process and the cycles it has run for on that level (MLFQ and PRIO)
+    int level;
+    unsigned long level_cycles;
+    // total tickets (STRIDE) or load weight (CFS) of the processes waiting for or running on this CPU, and its virtual
+    // time that new processes start at (the global pass for STRIDE and the minimum virtual runtime for CFS)
+    uint64_t weight, virtual_time;
+};
+
+struct machine {
+    const scheduler_t *scheduler;
+    // amount of time per cycle
+    int quantum;
+    int num_cpus;
+    cpu_t *cpus;
+    // multi-level feedback queue or priority levels, with the time spent running on each level
+    // (boosts move processes to the top level for MLFQ and up one level for PRIO)
+    int num_levels;
+    uint32_t boost_interval, aging_interval;
+    uint64_t next_boost;
+    event_t *boost;
+    uint64_t *level_time;
+    unsigned long num_demotions, num_boosts;
+    // load of each CPU, and the processes of a batch being admitted with the CPU each was given to
+    int *loads;
+    process_t **batch;
+    int *batch_cpus;
+    int batch_capacity;
+};
+
+
+/**
+ * Finds a scheduling algorithm by name (exits if there is no such algorithm)
+ *
+ * @param name Name of scheduling algorithm
+ * @return Scheduling algorithm
+ */
+const scheduler_t *get_scheduler(char *name);
+
+/**
+ * Creates the simulated CPUs, each with an empty ready queue
+ *
+ * @param scheduler Scheduling algorithm to be used
+ * @param quantum Amount of time per cycle
+ * @param num_cpus Number of CPUs
+ * @param num_levels Number of levels of the multi-level feedback queue
+ * @param boost_interval Time between moving all processes to the top level of the multi-level feedback queue
+ * @param aging_interval Time between moving waiting processes up a priority level
+ * @return Machine with idle CPUs
+ */
+machine_t *create_machine(const scheduler_t *scheduler, int quantum, int num_cpus, int num_levels,
+                          uint32_t boost_interval, uint32_t aging_interval);
+
+/**
+ * Frees the CPUs and any processes still waiting in their ready queues
+ *
+ * @param machine Machine to be freed
+ */
+void free_machine(machine_t *machine);
+
+/**
+ * Adds processes that have been allocated memory in order, each to the ready queue of the CPU with the least
+ * processes (waiting or running), using the lowest numbered CPU if there is a tie
+ * The processes given to each CPU are added to its ready queue at once
+ *
+ * @param machine Simulated CPUs
+ * @param processes Processes that are ready
+ * @param num_processes Number of processes
+ */
+void add_ready(machine_t *machine, process_t **processes, int num_processes);
+
+/**
+ * Takes the next process for an idle CPU from its own ready queue, or steals one from the CPU with the most
+ * processes waiting if it has none
+ *
+ * @param machine Simulated CPUs
+ * @param cpu Idle CPU
+ * @param level Level of the process (always 0 other than for MLFQ and PRIO)
+ * @return Process to be ran (NULL if no processes are waiting)
+ */
+process_t *pick_next(machine_t *machine, cpu_t *cpu, int *level);
+
+/**
+ * Ends the quantum of the process running on a CPU, putting it back in the ready queue if it should be switched out
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU with a running process
+ * @param level Level of the next process (always 0 other than for MLFQ and PRIO)
+ * @return Process to be ran instead or NULL if the running process continues
+ */
+process_t *end_quantum(machine_t *machine, cpu_t *cpu, int *level);
+
+/**
+ * Runs the process on a CPU for a cycle, updating its service time and the ready queue
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU with a running process
+ * @param quantum Amount of time per cycle
+ * @return 1 if the process finished, 0 otherwise
+ */
+int run_cycle(machine_t *machine, cpu_t *cpu, int quantum);
+
+/**
+ * Gets the time of the next cycle in which the process running on a CPU could be switched out by end_quantum()
+ *
+ * @param machine Simulated CPUs
+ * @param cpu CPU with a running process
+ * @param sim_time Current simulation time
+ * @param quantum Amount of time per cycle
+ * @return Simulation time of the quantum expiry or NO_EVENT if it only changes when a process arrives or finishes
+ */
+uint64_t next_expiry(machine_t *machine, cpu_t *cpu, uint32_t sim_time, int quantum);
+
+/**
+ * Moves waiting processes up levels if a boost is due (MLFQ and PRIO only)
+ *
+ * @param machine Simulated CPUs
+ * @param sim_time Current simulation time
+ */
+void boost_if_due(machine_t *machine, uint32_t sim_time);
+
+/**
+ * Moves the next boost past the cycles skipped before the next event if boosts would change nothing in them, so that
+ * processes are only aged for the intervals they spent waiting
+ *
+ * @param machine Simulated CPUs
+ * @param next_time Simulation time of the next cycle with an event
+ */
+void skip_boosts(machine_t *machine, uint64_t next_time);
+
+/**
+ * Gets the time of the next boost
+ *
+ * @param machine Simulated CPUs
+ * @return Simulation time of the next boost or NO_EVENT if the scheduler has none or it would change nothing
+ */
+uint64_t next_boost_time(machine_t *machine);
+
+/**
+ * Counts the processes waiting in all ready queues
+ *
+ * @param machine Simulated CPUs
+ * @return Number of waiting processes
+ */
+int count_waiting(machine_t *machine);
+
+/**
+ * Counts the CPUs that are running a process
+ *
+ * @param machine Simulated CPUs
+ * @return Number of running processes
+ */
+int count_running(machine_t *machine);
+
+/**
+ * Prints the utilization of each CPU if there is more than one, and statistics specific to the scheduler
+ *
+ * @param machine Simulated CPUs
+ * @param makespan Final simulation time
+ * @param finished List of completed processes
+ */
+void print_scheduler_statistics(machine_t *machine, uint32_t makespan, list_t *finished);
+
+#endif